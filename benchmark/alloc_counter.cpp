@@ -0,0 +1,52 @@
+#include "alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new/delete of the alloc_benchmarks executable only, so
+// that the timings of the regular benchmarks are not affected by the counting. Kept in
+// its own translation unit so that the replacements are never inlined into call sites.
+
+namespace {
+std::atomic<uint64_t> g_operator_new_count{0};
+} // namespace
+
+uint64_t operator_new_count()
+{
+    return g_operator_new_count.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size)
+{
+    g_operator_new_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    std::free(p);
+}
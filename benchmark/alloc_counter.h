@@ -0,0 +1,9 @@
+#ifndef VELK_BENCHMARK_ALLOC_COUNTER_H
+#define VELK_BENCHMARK_ALLOC_COUNTER_H
+
+#include <cstdint>
+
+/** @brief Returns the number of global operator new calls made so far. */
+uint64_t operator_new_count();
+
+#endif // VELK_BENCHMARK_ALLOC_COUNTER_H
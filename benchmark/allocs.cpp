@@ -0,0 +1,165 @@
+#include "alloc_counter.h"
+
+#include <velk/api/any.h>
+#include <velk/api/callback.h>
+#include <velk/api/event.h>
+#include <velk/api/property.h>
+#include <velk/api/velk.h>
+#include <velk/ext/object.h>
+#include <velk/interface/intf_metadata.h>
+#include <velk/plugins/animator/animator.h>
+#include <velk_c.h>
+
+#include <benchmark/benchmark.h>
+
+// Heap allocations per operation. These benchmarks live in their own executable
+// (alloc_benchmarks) because counting replaces the global operator new, which would
+// skew the timings of everything else. Only the "allocs" counter is meaningful here.
+
+using namespace velk;
+
+class IBenchWidget : public Interface<IBenchWidget>
+{
+public:
+    VELK_INTERFACE(
+        (PROP, float, value, 0.f),
+        (EVT, on_changed),
+        (FN, void, add, (int, x), (float, y))
+    )
+};
+
+class BenchWidget : public ext::Object<BenchWidget, IBenchWidget>
+{
+    void fn_add(int, float) override {}
+};
+
+static void ensureRegistered()
+{
+    static bool done = false;
+    if (!done) {
+        instance().type_registry().register_type<BenchWidget>();
+        done = true;
+    }
+}
+
+// Allocations counted by the velk allocator slots (velk::vector, small_vector spills,
+// control blocks, hive pages) plus global operator new calls (on ELF platforms this
+// includes those made inside the velk shared library).
+static uint64_t total_allocations()
+{
+    uint64_t count = operator_new_count();
+    for (size_t i = 0; i < allocator_slot_count; ++i) {
+        count += instance().get_allocator_stats(static_cast<AllocatorSlot>(i)).allocations;
+    }
+    return count;
+}
+
+static void set_alloc_counter(benchmark::State& state, uint64_t before)
+{
+    state.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(total_allocations() - before), benchmark::Counter::kAvgIterations);
+}
+
+static void BM_AllocsObjectCreate(benchmark::State& state)
+{
+    ensureRegistered();
+    auto uid = BenchWidget::class_id();
+    auto before = total_allocations();
+    for (auto _ : state) {
+        auto obj = instance().create<IObject>(uid);
+        auto* meta = interface_cast<IMetadata>(obj);
+        benchmark::DoNotOptimize(meta->get_property("value").get());
+    }
+    set_alloc_counter(state, before);
+}
+BENCHMARK(BM_AllocsObjectCreate);
+
+static void BM_AllocsEventSubscribe(benchmark::State& state)
+{
+    ensureRegistered();
+    auto uid = BenchWidget::class_id();
+    Callback immediate([](FnArgs) -> ReturnValue { return ReturnValue::Success; });
+    Callback deferred([](FnArgs) -> ReturnValue { return ReturnValue::Success; });
+    auto before = total_allocations();
+    for (auto _ : state) {
+        auto obj = instance().create<IObject>(uid);
+        Event evt = interface_cast<IBenchWidget>(obj)->on_changed();
+        evt.add_handler(immediate, Immediate);
+        evt.add_handler(deferred, Deferred);
+        benchmark::DoNotOptimize(evt.has_handlers());
+    }
+    set_alloc_counter(state, before);
+}
+BENCHMARK(BM_AllocsEventSubscribe);
+
+static void BM_AllocsDeferredDispatch(benchmark::State& state)
+{
+    ensureRegistered();
+    auto obj = instance().create<IObject>(BenchWidget::class_id());
+    auto* iw = interface_cast<IBenchWidget>(obj);
+    Event evt = iw->on_changed();
+    evt.add_handler([](FnArgs) -> ReturnValue { return ReturnValue::Success; }, Deferred);
+    evt.add_handler([](FnArgs) -> ReturnValue { return ReturnValue::Success; }, Deferred);
+    Any<int> arg(1);
+    const IAny* args[] = {arg.get_any_interface()};
+    instance().update();
+    auto before = total_allocations();
+    for (auto _ : state) {
+        evt.invoke({args, 1}, Deferred);
+        instance().update();
+    }
+    set_alloc_counter(state, before);
+}
+BENCHMARK(BM_AllocsDeferredDispatch);
+
+// C API invoke of add(int, float) through an argument list and through an inline argument array
+static void BM_AllocsCApiInvoke(benchmark::State& state)
+{
+    ensureRegistered();
+    auto obj = instance().create<IObject>(BenchWidget::class_id());
+    auto h = reinterpret_cast<velk_object>(static_cast<IInterface*>(obj.get()));
+    velk_function fn = velk_get_function(h, "add");
+    velk_arg argv[2];
+    argv[0].type = VELK_TYPE_INT32;
+    argv[0].value.i32 = 1;
+    argv[1].type = VELK_TYPE_FLOAT;
+    argv[1].value.f32 = 2.f;
+    auto mode = state.range(0);
+    auto before = total_allocations();
+    for (auto _ : state) {
+        if (mode == 0) {
+            velk_args args = velk_args_create(2);
+            velk_args_set_int32(args, 0, 1);
+            velk_args_set_float(args, 1, 2.f);
+            velk_invoke_args(fn, args);
+            velk_args_destroy(args);
+        } else {
+            velk_invoke_argv(fn, argv, 2);
+        }
+    }
+    set_alloc_counter(state, before);
+    velk_release(fn);
+}
+BENCHMARK(BM_AllocsCApiInvoke)->ArgName("mode")->Arg(0)->Arg(1);
+
+static void BM_AllocsTransitionRetarget(benchmark::State& state)
+{
+    ensureRegistered();
+    instance().plugin_registry().load_plugin_from_path(BENCH_ANIMATOR_DLL_PATH);
+    auto obj = instance().create<IObject>(BenchWidget::class_id());
+    auto value = interface_cast<IBenchWidget>(obj)->value();
+    auto tr = create_transition(value, Duration::from_seconds(1.f));
+    UpdateInfo info{{}, {}, Duration::from_seconds(0.1f)};
+    value.set_value(1.f);
+    default_animator().tick(info);
+    instance().update({});
+    float target = 0.f;
+    auto before = total_allocations();
+    for (auto _ : state) {
+        value.set_value(target += 1.f);
+        default_animator().tick(info);
+        instance().update({});
+    }
+    set_alloc_counter(state, before);
+}
+BENCHMARK(BM_AllocsTransitionRetarget);
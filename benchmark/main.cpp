@@ -1,4 +1,5 @@
 #include <velk/api/any.h>
+#include <velk/api/bulk.h>
 #include <velk/api/callback.h>
 #include <velk/api/event.h>
 #include <velk/api/function.h>
@@ -11,10 +12,16 @@
 #include <velk/ext/object.h>
 #include <velk/interface/hive/intf_hive_store.h>
 #include <velk/interface/intf_metadata.h>
+#include <velk/plugins/animator/animator.h>
+#include <velk_c.h>
 
 #include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace velk;
 
@@ -116,6 +123,376 @@ static void BM_DirectStateWrite(benchmark::State& state)
 }
 BENCHMARK(BM_DirectStateWrite);
 
+// ---------------------------------------------------------------------------
+// Bulk property access across many objects
+// ---------------------------------------------------------------------------
+
+static constexpr int kBulkObjectCount = 1000;
+
+static vector<IObject::Ptr> make_bulk_objects()
+{
+    ensureRegistered();
+    vector<IObject::Ptr> objects;
+    for (int i = 0; i < kBulkObjectCount; ++i) {
+        objects.push_back(instance().create<IObject>(BenchWidget::class_id()));
+    }
+    return objects;
+}
+
+static void BM_BulkGetValueLoop(benchmark::State& state)
+{
+    auto objects = make_bulk_objects();
+    vector<float> out(objects.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < objects.size(); ++i) {
+            out[i] = interface_cast<IBenchWidget>(objects[i])->value().get_value();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_BulkGetValueLoop);
+
+static void BM_BulkGather(benchmark::State& state)
+{
+    auto objects = make_bulk_objects();
+    vector<float> out(objects.size());
+    for (auto _ : state) {
+        gather<IBenchWidget>(objects, &IBenchWidget::State::value, out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_BulkGather);
+
+static void BM_BulkGatherByName(benchmark::State& state)
+{
+    auto objects = make_bulk_objects();
+    vector<float> out(objects.size());
+    for (auto _ : state) {
+        gather(array_view<IObject::Ptr>(objects), "value", out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_BulkGatherByName);
+
+static void BM_BulkScatterBatched(benchmark::State& state)
+{
+    auto objects = make_bulk_objects();
+    vector<float> values(objects.size(), 1.f);
+    for (auto _ : state) {
+        scatter<IBenchWidget>(objects, &IBenchWidget::State::value, values.data(), ScatterNotify::Batched);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_BulkScatterBatched);
+
+// ---------------------------------------------------------------------------
+// C API: one call per property vs batched calls
+// ---------------------------------------------------------------------------
+
+struct CApiBulkFixture
+{
+    vector<IObject::Ptr> objects = make_bulk_objects();
+    vector<velk_object> handles;
+    vector<velk_property> props;
+
+    CApiBulkFixture()
+    {
+        for (auto& o : objects) {
+            handles.push_back(reinterpret_cast<velk_object>(static_cast<IInterface*>(o.get())));
+            props.push_back(velk_get_property(handles.back(), "value"));
+        }
+    }
+    ~CApiBulkFixture()
+    {
+        for (auto p : props) {
+            velk_release(p);
+        }
+    }
+};
+
+static void BM_CApiPropertyGetLoop(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    vector<float> out(f.props.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < f.props.size(); ++i) {
+            velk_property_get_float(f.props[i], &out[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_CApiPropertyGetLoop);
+
+static void BM_CApiPropertyGetMany(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    vector<float> out(f.props.size());
+    for (auto _ : state) {
+        velk_property_get_many(f.props.data(), f.props.size(), out.data(), sizeof(float), VELK_TYPE_FLOAT);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_CApiPropertyGetMany);
+
+static void BM_CApiGather(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    vector<float> out(f.handles.size());
+    for (auto _ : state) {
+        velk_gather(f.handles.data(), f.handles.size(), "value", out.data(), sizeof(float), VELK_TYPE_FLOAT);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_CApiGather);
+
+static void BM_CApiStateRead(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    auto cls = BenchWidget::class_id();
+    velk_uid intf = {IBenchWidget::UID.hi, IBenchWidget::UID.lo};
+    velk_state_field field{};
+    velk_describe_state({cls.hi, cls.lo}, intf, &field, 1);
+    vector<float> out(f.handles.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < f.handles.size(); ++i) {
+            auto* s = static_cast<const char*>(velk_get_state(f.handles[i], intf));
+            std::memcpy(&out[i], s + field.offset, sizeof(float));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_CApiStateRead);
+
+static void BM_CApiScatterBatched(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    vector<float> values(f.handles.size(), 1.f);
+    for (auto _ : state) {
+        velk_scatter(f.handles.data(), f.handles.size(), "value", values.data(), sizeof(float), VELK_TYPE_FLOAT,
+                     VELK_NOTIFY_BATCHED);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_CApiScatterBatched);
+
+static void BM_CApiGetPropertyByName(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    auto h = f.handles[0];
+    for (auto _ : state) {
+        auto p = velk_get_property(h, "value");
+        benchmark::DoNotOptimize(p);
+        velk_release(p);
+    }
+}
+BENCHMARK(BM_CApiGetPropertyByName);
+
+static void BM_CApiGetPropertyByOrdinal(benchmark::State& state)
+{
+    CApiBulkFixture f;
+    auto h = f.handles[0];
+    auto uid = BenchWidget::class_id();
+    int32_t ordinal = velk_resolve_member({uid.hi, uid.lo}, "value", VELK_MEMBER_PROPERTY);
+    for (auto _ : state) {
+        auto p = velk_get_property_by_ordinal(h, ordinal);
+        benchmark::DoNotOptimize(p);
+        velk_release(p);
+    }
+}
+BENCHMARK(BM_CApiGetPropertyByOrdinal);
+
+// ---------------------------------------------------------------------------
+// Animator tick over many scalar keyframe tracks
+// ---------------------------------------------------------------------------
+
+static void BM_AnimatorTickFloatTracks(benchmark::State& state)
+{
+    instance().plugin_registry().load_plugin_from_path(BENCH_ANIMATOR_DLL_PATH);
+    auto animatorObj = instance().create<IObject>(ClassId::Animator);
+    auto* animator = interface_cast<IAnimator>(animatorObj);
+    animator->set_thread_count(static_cast<size_t>(state.range(0)));
+    auto objects = make_bulk_objects();
+    vector<Animation> tracks;
+    auto keyframes = vector<Keyframe<float>>{
+        {Duration::from_seconds(0.f), 0.f},
+        {Duration::from_seconds(1000.f), 100.f, easing::in_out_quad},
+    };
+    for (auto& obj : objects) {
+        tracks.push_back(create_track(*animator, interface_cast<IBenchWidget>(obj)->value(), keyframes));
+    }
+    UpdateInfo info{{}, {}, Duration{1}};
+    for (auto _ : state) {
+        animator->tick(info);
+        state.PauseTiming();
+        instance().update({}); // Flushes the queued on_changed notifications
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_AnimatorTickFloatTracks)->ArgName("threads")->Arg(1)->Arg(4);
+
+static void BM_AnimatorTickLongTracks(benchmark::State& state)
+{
+    instance().plugin_registry().load_plugin_from_path(BENCH_ANIMATOR_DLL_PATH);
+    auto animatorObj = instance().create<IObject>(ClassId::Animator);
+    auto* animator = interface_cast<IAnimator>(animatorObj);
+    auto objects = make_bulk_objects();
+    vector<Keyframe<float>> keyframes;
+    for (int i = 0; i < state.range(0); ++i) {
+        keyframes.push_back({Duration::from_seconds(static_cast<float>(i)), static_cast<float>(i % 7)});
+    }
+    vector<Animation> tracks;
+    for (auto& obj : objects) {
+        tracks.push_back(create_track(*animator, interface_cast<IBenchWidget>(obj)->value(), keyframes));
+        tracks.back().seek(0.5f); // Mid-track, half of the keyframes are behind the playhead
+    }
+    UpdateInfo info{{}, {}, Duration{1}};
+    for (auto _ : state) {
+        animator->tick(info);
+        state.PauseTiming();
+        instance().update({});
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_AnimatorTickLongTracks)->ArgName("keyframes")->Arg(2)->Arg(1024);
+
+/// Built-in easing curves, indexed by easing::EasingId.
+static easing::EasingFn easing_curve(int64_t id)
+{
+    const easing::EasingFn curves[] = {
+        nullptr,
+        easing::linear,      easing::in_quad,  easing::out_quad,    easing::in_out_quad, easing::in_cubic,
+        easing::out_cubic,   easing::in_out_cubic, easing::in_sine, easing::out_sine,    easing::in_out_sine,
+        easing::in_expo,     easing::out_expo, easing::in_out_expo, easing::in_elastic,  easing::out_elastic,
+        easing::in_bounce,   easing::out_bounce,
+    };
+    return curves[id];
+}
+
+/// Eases 1024 values per iteration: mode 0 calls the scalar function through a pointer,
+/// mode 1 runs the bulk kernel, mode 2 blends a 256-sample EasingLut.
+static void BM_Easing(benchmark::State& state)
+{
+    constexpr size_t n = 1024;
+    auto fn = easing_curve(state.range(0));
+    auto kernel = easing::bulk_easing(easing::easing_id(fn));
+    easing::EasingLut lut(fn);
+    vector<float> t(n);
+    vector<float> out(n);
+    for (size_t i = 0; i < n; ++i) {
+        t[i] = static_cast<float>(i) / static_cast<float>(n - 1);
+    }
+    auto* volatile indirect = fn; // Keeps the scalar call indirect, as in the animator
+    for (auto _ : state) {
+        switch (state.range(1)) {
+        case 0:
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = indirect(t[i]);
+            }
+            break;
+        case 1: kernel(t.data(), out.data(), n); break;
+        default: lut.evaluate(t.data(), out.data(), n); break;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Easing)
+    ->ArgNames({"curve", "mode"})
+    ->ArgsProduct({benchmark::CreateDenseRange(1, static_cast<int>(easing::EasingId::Count) - 1, 1), {0, 1, 2}});
+
+static void BM_AnimatorTickBakedTracks(benchmark::State& state)
+{
+    instance().plugin_registry().load_plugin_from_path(BENCH_ANIMATOR_DLL_PATH);
+    auto animatorObj = instance().create<IObject>(ClassId::Animator);
+    auto* animator = interface_cast<IAnimator>(animatorObj);
+    auto objects = make_bulk_objects();
+    vector<Animation> tracks;
+    auto keyframes = vector<Keyframe<float>>{
+        {Duration::from_seconds(0.f), 0.f},
+        {Duration::from_seconds(1000.f), 100.f, easing::in_elastic},
+    };
+    for (auto& obj : objects) {
+        tracks.push_back(create_track(*animator, interface_cast<IBenchWidget>(obj)->value(), keyframes));
+        if (state.range(0)) {
+            tracks.back().bake(1.f);
+        }
+    }
+    UpdateInfo info{{}, {}, Duration{1}};
+    for (auto _ : state) {
+        animator->tick(info);
+        state.PauseTiming();
+        instance().update({});
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_AnimatorTickBakedTracks)->ArgName("baked")->Arg(0)->Arg(1);
+
+static void BM_AnimatorTickMostlyIdle(benchmark::State& state)
+{
+    instance().plugin_registry().load_plugin_from_path(BENCH_ANIMATOR_DLL_PATH);
+    auto animatorObj = instance().create<IObject>(ClassId::Animator);
+    auto* animator = interface_cast<IAnimator>(animatorObj);
+    auto objects = make_bulk_objects();
+    vector<Animation> tracks;
+    auto keyframes = vector<Keyframe<float>>{
+        {Duration::from_seconds(0.f), 0.f},
+        {Duration::from_seconds(1000.f), 100.f},
+    };
+    for (int i = 0; i < kBulkObjectCount; ++i) {
+        tracks.push_back(create_track(*animator, interface_cast<IBenchWidget>(objects[i])->value(), keyframes));
+        if (i % 100) {
+            tracks.back().finish(); // 1% of the animations keep playing
+        }
+    }
+    UpdateInfo info{{}, {}, Duration{1}};
+    for (auto _ : state) {
+        animator->tick(info);
+        state.PauseTiming();
+        instance().update({});
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_AnimatorTickMostlyIdle);
+
+static void BM_AnimatorTickThrottled(benchmark::State& state)
+{
+    instance().plugin_registry().load_plugin_from_path(BENCH_ANIMATOR_DLL_PATH);
+    auto animatorObj = instance().create<IObject>(ClassId::Animator);
+    auto* animator = interface_cast<IAnimator>(animatorObj);
+    auto objects = make_bulk_objects();
+    vector<Animation> tracks;
+    auto keyframes = vector<Keyframe<float>>{
+        {Duration::from_seconds(0.f), 0.f},
+        {Duration::from_seconds(1000.f), 100.f},
+    };
+    UpdatePolicy policy;
+    policy.frameInterval = static_cast<uint32_t>(state.range(0));
+    for (int i = 0; i < kBulkObjectCount; ++i) {
+        tracks.push_back(create_track(*animator, interface_cast<IBenchWidget>(objects[i])->value(), keyframes));
+        animator->set_update_policy(tracks.back().get_animation_interface(), policy);
+    }
+    UpdateInfo info{{}, {}, Duration{1}};
+    for (auto _ : state) {
+        animator->tick(info);
+        instance().update({}); // Includes the notifications of the evaluated tracks
+    }
+    state.SetItemsProcessed(state.iterations() * kBulkObjectCount);
+}
+BENCHMARK(BM_AnimatorTickThrottled)->ArgName("interval")->Arg(1)->Arg(4);
+
 // ---------------------------------------------------------------------------
 // Function invoke
 // ---------------------------------------------------------------------------
@@ -202,6 +579,34 @@ static void BM_InterfaceCast(benchmark::State& state)
 }
 BENCHMARK(BM_InterfaceCast);
 
+template <int I>
+class IWide : public Interface<IWide<I>>
+{};
+
+class WideObject : public ext::ObjectCore<WideObject, IWide<0>, IWide<1>, IWide<2>, IWide<3>, IWide<4>, IWide<5>,
+                                          IWide<6>, IWide<7>, IWide<8>, IWide<9>, IWide<10>, IWide<11>>
+{};
+
+// Casts to the first and last declared interface of a class implementing 13 interfaces
+// (12 + IObject). Lookup cost should not depend on the position of the interface.
+static void BM_InterfaceCastWideFirst(benchmark::State& state)
+{
+    auto obj = ext::make_object<WideObject>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interface_cast<IWide<0>>(obj));
+    }
+}
+BENCHMARK(BM_InterfaceCastWideFirst);
+
+static void BM_InterfaceCastWideLast(benchmark::State& state)
+{
+    auto obj = ext::make_object<WideObject>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interface_cast<IWide<11>>(obj));
+    }
+}
+BENCHMARK(BM_InterfaceCastWideLast);
+
 // ---------------------------------------------------------------------------
 // Metadata lookup
 // ---------------------------------------------------------------------------
@@ -246,6 +651,17 @@ static void BM_ObjectCreate(benchmark::State& state)
 }
 BENCHMARK(BM_ObjectCreate);
 
+static void BM_TypeRegistryFind(benchmark::State& state)
+{
+    ensureRegistered();
+    auto& registry = instance().type_registry();
+    auto uid = BenchWidget::class_id();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.find_factory(uid));
+    }
+}
+BENCHMARK(BM_TypeRegistryFind);
+
 // ---------------------------------------------------------------------------
 // Control block allocation: pooled vs raw new/delete
 // ---------------------------------------------------------------------------
@@ -271,6 +687,223 @@ static void BM_ControlBlockNewDelete(benchmark::State& state)
 }
 BENCHMARK(BM_ControlBlockNewDelete);
 
+// Producer/consumer: blocks are allocated on the benchmark thread and released
+// on a consumer thread. The hit_rate counter is the fraction of producer-side
+// allocations served from the pool (via the cross-thread depot).
+static void BM_ControlBlockCrossThread(benchmark::State& state)
+{
+    constexpr size_t batch_size = 256;
+    constexpr size_t max_in_flight = 4;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::vector<control_block*>> queue;
+    bool done = false;
+
+    std::thread consumer([&] {
+        std::unique_lock lock(mutex);
+        while (true) {
+            cv.wait(lock, [&] { return done || !queue.empty(); });
+            if (queue.empty()) {
+                break;
+            }
+            auto work = std::move(queue);
+            queue.clear();
+            lock.unlock();
+            cv.notify_all();
+            for (auto& batch : work) {
+                for (auto* b : batch) {
+                    detail::dealloc_control_block(b);
+                }
+            }
+            lock.lock();
+        }
+    });
+
+    auto before = detail::get_block_pool_stats();
+    for (auto _ : state) {
+        std::vector<control_block*> batch;
+        batch.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            batch.push_back(detail::alloc_control_block());
+        }
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [&] { return queue.size() < max_in_flight; });
+        queue.push_back(std::move(batch));
+        lock.unlock();
+        cv.notify_all();
+    }
+    {
+        std::lock_guard lock(mutex);
+        done = true;
+    }
+    cv.notify_all();
+    consumer.join();
+    auto after = detail::get_block_pool_stats();
+
+    auto allocs = after.allocs - before.allocs;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch_size));
+    state.counters["hit_rate"] =
+        allocs ? static_cast<double>(after.hits - before.hits) / static_cast<double>(allocs) : 0.0;
+}
+BENCHMARK(BM_ControlBlockCrossThread);
+
+// ---------------------------------------------------------------------------
+// Reference counting: atomic vs thread-confined
+// ---------------------------------------------------------------------------
+
+static void BM_SharedPtrCopyAtomic(benchmark::State& state)
+{
+    ensureRegistered();
+    auto obj = instance().create<IObject>(BenchWidget::class_id());
+    for (auto _ : state) {
+        auto copy = obj;
+        benchmark::DoNotOptimize(copy.get());
+    }
+}
+BENCHMARK(BM_SharedPtrCopyAtomic);
+
+static void BM_SharedPtrCopyThreadConfined(benchmark::State& state)
+{
+    ensureRegistered();
+    auto obj = instance().create<IObject>(BenchWidget::class_id(), ObjectFlags::ThreadConfined);
+    for (auto _ : state) {
+        auto copy = obj;
+        benchmark::DoNotOptimize(copy.get());
+    }
+}
+BENCHMARK(BM_SharedPtrCopyThreadConfined);
+
+static void BM_GetSelfAtomic(benchmark::State& state)
+{
+    ensureRegistered();
+    auto obj = instance().create<IObject>(BenchWidget::class_id());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj->get_self<IBenchWidget>().get());
+    }
+}
+BENCHMARK(BM_GetSelfAtomic);
+
+static void BM_GetSelfThreadConfined(benchmark::State& state)
+{
+    ensureRegistered();
+    auto obj = instance().create<IObject>(BenchWidget::class_id(), ObjectFlags::ThreadConfined);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(obj->get_self<IBenchWidget>().get());
+    }
+}
+BENCHMARK(BM_GetSelfThreadConfined);
+
+// ---------------------------------------------------------------------------
+// velk::vector growth/insert/erase: relocatable vs element-wise
+// ---------------------------------------------------------------------------
+
+// A non-trivial pointer wrapper (like a smart pointer without the refcount). The two
+// types differ only in the relocatable trait, so the benchmarks isolate the cost of
+// realloc/memmove vs element-wise move construction.
+struct BenchHandle
+{
+    explicit BenchHandle(void* p = nullptr) : ptr(p) {}
+    BenchHandle(const BenchHandle& o) : ptr(o.ptr) {}
+    BenchHandle(BenchHandle&& o) noexcept : ptr(o.ptr) { o.ptr = nullptr; }
+    BenchHandle& operator=(const BenchHandle& o)
+    {
+        ptr = o.ptr;
+        return *this;
+    }
+    BenchHandle& operator=(BenchHandle&& o) noexcept
+    {
+        ptr = o.ptr;
+        o.ptr = nullptr;
+        return *this;
+    }
+    ~BenchHandle() {}
+    void* ptr;
+};
+
+struct RelocatableBenchHandle : BenchHandle
+{
+    using BenchHandle::BenchHandle;
+};
+
+namespace velk {
+template <>
+struct is_trivially_relocatable<RelocatableBenchHandle> : std::true_type
+{};
+} // namespace velk
+
+static constexpr int kVectorOpCount = 1000;
+
+template <class Handle>
+static void vector_growth(benchmark::State& state, const Handle& value)
+{
+    for (auto _ : state) {
+        vector<Handle> v;
+        for (int i = 0; i < kVectorOpCount; ++i) {
+            v.push_back(value);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+template <class Handle>
+static void vector_insert_front(benchmark::State& state, const Handle& value)
+{
+    vector<Handle> v(kVectorOpCount, value);
+    for (auto _ : state) {
+        v.insert(v.begin(), value);
+        v.erase(v.begin());
+    }
+}
+
+template <class Handle>
+static void vector_erase_front(benchmark::State& state, const Handle& value)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        vector<Handle> v(kVectorOpCount, value);
+        state.ResumeTiming();
+        while (!v.empty()) {
+            v.erase(v.begin());
+        }
+    }
+}
+
+static void BM_VectorGrowthRelocatable(benchmark::State& state)
+{
+    vector_growth(state, RelocatableBenchHandle(&state));
+}
+BENCHMARK(BM_VectorGrowthRelocatable);
+
+static void BM_VectorGrowthElementwise(benchmark::State& state)
+{
+    vector_growth(state, BenchHandle(&state));
+}
+BENCHMARK(BM_VectorGrowthElementwise);
+
+static void BM_VectorInsertRelocatable(benchmark::State& state)
+{
+    vector_insert_front(state, RelocatableBenchHandle(&state));
+}
+BENCHMARK(BM_VectorInsertRelocatable);
+
+static void BM_VectorInsertElementwise(benchmark::State& state)
+{
+    vector_insert_front(state, BenchHandle(&state));
+}
+BENCHMARK(BM_VectorInsertElementwise);
+
+static void BM_VectorEraseRelocatable(benchmark::State& state)
+{
+    vector_erase_front(state, RelocatableBenchHandle(&state));
+}
+BENCHMARK(BM_VectorEraseRelocatable);
+
+static void BM_VectorEraseElementwise(benchmark::State& state)
+{
+    vector_erase_front(state, BenchHandle(&state));
+}
+BENCHMARK(BM_VectorEraseElementwise);
+
 // ---------------------------------------------------------------------------
 // Hive vs vector-of-structs comparison
 // ---------------------------------------------------------------------------
@@ -582,6 +1215,44 @@ static void BM_IterateHiveState(benchmark::State& state)
 }
 BENCHMARK(BM_IterateHiveState);
 
+static void BM_CApiIterateHivePages(benchmark::State& state)
+{
+    ensureRegistered();
+    ensureHiveRegistered();
+    auto cls = HiveData::class_id();
+    velk_uid intf = {IHiveData::UID.hi, IHiveData::UID.lo};
+    velk_hive_store store = velk_create_hive_store();
+    velk_hive hive = velk_get_hive(store, {cls.hi, cls.lo});
+    velk_hive_add_many(hive, kHiveCount, nullptr);
+    ptrdiff_t offset = velk_hive_state_offset(hive, intf);
+
+    vector<velk_hive_page> pages(velk_hive_page_count(hive));
+    for (auto _ : state) {
+        // What a foreign caller does: fetch the page spans once, then walk the bitmasks itself
+        size_t count = velk_hive_get_pages(hive, pages.data(), pages.size());
+        float sum = 0.f;
+        for (size_t p = 0; p < count; ++p) {
+            auto& page = pages[p];
+            for (size_t w = 0; w < page.active_words; ++w) {
+                uint64_t bits = page.active_bits[w];
+                for (size_t b = 0; bits; ++b, bits >>= 1) {
+                    if (bits & 1) {
+                        auto* slot = static_cast<const char*>(page.slots) + (w * 64 + b) * page.stride;
+                        auto& s = *reinterpret_cast<const IHiveData::State*>(slot + offset);
+                        sum += s.f0 + s.f1 + s.f2 + s.f3 + s.f4;
+                        sum += static_cast<float>(s.i0 + s.i1 + s.i2 + s.i3 + s.i4);
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    velk_release(hive);
+    velk_release(store);
+}
+BENCHMARK(BM_CApiIterateHivePages);
+
 // --- Iteration speed: write all 10 fields ---
 
 static void BM_IterateWritePlainVector(benchmark::State& state)
@@ -0,0 +1,203 @@
+#include <velk/allocator.h>
+#include <velk/api/callback.h>
+#include <velk/api/hive/raw_hive.h>
+#include <velk/api/velk.h>
+#include <velk/ext/object.h>
+#include <velk/interface/hive/intf_hive_store.h>
+#include <velk/interface/intf_hierarchy.h>
+#include <velk/vector.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace velk;
+
+namespace {
+
+/** @brief Forwards to malloc and counts every call. */
+class TrackingAllocator : public IAllocator
+{
+public:
+    void* allocate(size_t size, size_t alignment) override
+    {
+        ++allocations;
+        bytes += size;
+        return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+    }
+    void deallocate(void* ptr, size_t size, size_t) override
+    {
+        ++deallocations;
+        bytes -= size;
+        std::free(ptr);
+    }
+
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> deallocations{0};
+    std::atomic<size_t> bytes{0};
+};
+
+struct AllocPoint
+{
+    float x, y;
+};
+
+class IAllocWidget : public Interface<IAllocWidget>
+{
+public:
+    VELK_INTERFACE(
+        (PROP, int, value, 0)
+    )
+};
+
+class AllocWidget : public ext::Object<AllocWidget, IAllocWidget>
+{};
+
+} // namespace
+
+TEST(Allocator, DefaultSlotCountsVectorStorage)
+{
+    auto before = instance().get_allocator_stats(AllocatorSlot::Default);
+    {
+        vector<int> v;
+        for (int i = 0; i < 100; ++i) {
+            v.push_back(i);
+        }
+    }
+    auto after = instance().get_allocator_stats(AllocatorSlot::Default);
+    EXPECT_GT(after.allocations, before.allocations);
+    EXPECT_EQ(after.bytes_allocated - before.bytes_allocated, after.bytes_freed - before.bytes_freed);
+}
+
+TEST(Allocator, DefaultSlotBacksHierarchyNodes)
+{
+    auto& velk = instance();
+    register_type<AllocWidget>(velk);
+    auto before = velk.get_allocator_stats(AllocatorSlot::Default);
+    {
+        auto hierarchy = velk.create<IHierarchy>(ClassId::Hierarchy);
+        ASSERT_TRUE(hierarchy);
+        auto root = velk.create<IObject>(AllocWidget::class_id());
+        ASSERT_EQ(ReturnValue::Success, hierarchy->set_root(root));
+        for (int i = 0; i < 8; ++i) {
+            ASSERT_EQ(ReturnValue::Success, hierarchy->add(root, velk.create<IObject>(AllocWidget::class_id())));
+        }
+        // One map node per object, the buckets and the growing child list
+        auto after = velk.get_allocator_stats(AllocatorSlot::Default);
+        EXPECT_GT(after.allocations - before.allocations, 9u);
+    }
+    unregister_type<AllocWidget>(velk);
+}
+
+TEST(Allocator, HiveSlotRoutesHivePages)
+{
+    auto& velk = instance();
+    TrackingAllocator tracker;
+    ASSERT_EQ(ReturnValue::Success, velk.set_allocator(AllocatorSlot::Hive, &tracker));
+    EXPECT_EQ(&tracker, detail::get_allocator(AllocatorSlot::Hive));
+    {
+        auto store = velk.create<IHiveStore>(ClassId::HiveStore);
+        ASSERT_TRUE(store);
+        RawHive<AllocPoint> hive(store->get_raw_hive<AllocPoint>());
+        for (int i = 0; i < 64; ++i) {
+            hive.emplace(AllocPoint{float(i), 0.f});
+        }
+        EXPECT_GT(tracker.allocations.load(), 0u);
+        EXPECT_GT(velk.get_allocator_stats(AllocatorSlot::Hive).live_bytes(), 0u);
+    }
+    EXPECT_EQ(tracker.allocations.load(), tracker.deallocations.load());
+    EXPECT_EQ(0u, tracker.bytes.load());
+    EXPECT_EQ(ReturnValue::Success, velk.set_allocator(AllocatorSlot::Hive, nullptr));
+}
+
+TEST(Allocator, SetAllocatorFailsWhileOutstanding)
+{
+    auto& velk = instance();
+    TrackingAllocator tracker;
+    ASSERT_EQ(ReturnValue::Success, velk.set_allocator(AllocatorSlot::Hive, &tracker));
+    {
+        auto store = velk.create<IHiveStore>(ClassId::HiveStore);
+        RawHive<AllocPoint> hive(store->get_raw_hive<AllocPoint>());
+        hive.emplace(AllocPoint{1.f, 2.f});
+
+        // Pages are still owned by the tracker, swapping it out would free them through the wrong allocator
+        TrackingAllocator other;
+        EXPECT_EQ(ReturnValue::Fail, velk.set_allocator(AllocatorSlot::Hive, &other));
+        EXPECT_EQ(&tracker, detail::get_allocator(AllocatorSlot::Hive));
+    }
+    EXPECT_EQ(ReturnValue::Success, velk.set_allocator(AllocatorSlot::Hive, nullptr));
+    EXPECT_EQ(nullptr, detail::get_allocator(AllocatorSlot::Hive));
+}
+
+TEST(Allocator, MetadataSlotBacksObjectStorage)
+{
+    auto& velk = instance();
+    register_type<AllocWidget>(velk);
+    auto before = velk.get_allocator_stats(AllocatorSlot::Metadata);
+    {
+        auto obj = velk.create<IObject>(AllocWidget::class_id());
+        ASSERT_TRUE(obj);
+        auto* meta = interface_cast<IMetadata>(obj);
+        ASSERT_TRUE(meta);
+        EXPECT_TRUE(meta->get_property("value"));
+    }
+    auto after = velk.get_allocator_stats(AllocatorSlot::Metadata);
+    EXPECT_GT(after.allocations, before.allocations);
+    unregister_type<AllocWidget>(velk);
+}
+
+TEST(Allocator, DeferredSlotBacksDeferredQueues)
+{
+    auto& velk = instance();
+    velk.update();
+    TrackingAllocator tracker;
+    ASSERT_EQ(ReturnValue::Success, velk.set_allocator(AllocatorSlot::Deferred, &tracker));
+
+    int calls = 0;
+    Callback fn([&](FnArgs) -> ReturnValue {
+        ++calls;
+        return ReturnValue::Success;
+    });
+    fn.invoke(Deferred);
+    EXPECT_GT(tracker.allocations.load(), 0u);
+    velk.update();
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(0u, tracker.bytes.load());
+    EXPECT_EQ(ReturnValue::Success, velk.set_allocator(AllocatorSlot::Deferred, nullptr));
+}
+
+TEST(Allocator, InstallWhileAllocatingNeverMixesAllocators)
+{
+    TrackingAllocator tracker;
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                void* p = detail::allocate(32, alignof(std::max_align_t), AllocatorSlot::Deferred);
+                detail::deallocate(p, 32, alignof(std::max_align_t), AllocatorSlot::Deferred);
+                std::this_thread::sleep_for(std::chrono::microseconds(20));
+            }
+        });
+    }
+    for (int i = 0; i < 500; ++i) {
+        detail::install_allocator(AllocatorSlot::Deferred, &tracker);
+        // Removing can fail while the tracker still owns a block, retry until it is returned
+        while (detail::get_allocator(AllocatorSlot::Deferred) &&
+               !detail::install_allocator(AllocatorSlot::Deferred, nullptr)) {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+    // Every block the tracker handed out came back to it, and it freed nothing else
+    EXPECT_EQ(tracker.allocations.load(), tracker.deallocations.load());
+    EXPECT_EQ(0u, tracker.bytes.load());
+    EXPECT_EQ(nullptr, detail::get_allocator(AllocatorSlot::Deferred));
+}
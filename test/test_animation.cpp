@@ -8,6 +8,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 using namespace velk;
 
 namespace {
@@ -99,6 +103,59 @@ TEST(Easing, QuadMidpoint)
     EXPECT_FLOAT_EQ(0.5f, easing::in_out_quad(0.5f));
 }
 
+TEST(Easing, EasingIds)
+{
+    EXPECT_EQ(easing::EasingId::InQuad, easing::easing_id(easing::in_quad));
+    EXPECT_EQ(easing::EasingId::Linear, easing::easing_id(nullptr));
+    EXPECT_EQ(easing::EasingId::Custom, easing::easing_id([](float t) { return t * 0.5f; }));
+    EXPECT_EQ(nullptr, easing::bulk_easing(easing::EasingId::Custom));
+}
+
+TEST(Easing, BulkKernelsMatchScalar)
+{
+    const easing::EasingFn curves[] = {
+        easing::linear,      easing::in_quad,  easing::out_quad,    easing::in_out_quad, easing::in_cubic,
+        easing::out_cubic,   easing::in_out_cubic, easing::in_sine, easing::out_sine,    easing::in_out_sine,
+        easing::in_expo,     easing::out_expo, easing::in_out_expo, easing::in_elastic,  easing::out_elastic,
+        easing::in_bounce,   easing::out_bounce,
+    };
+    constexpr size_t n = 1001;
+    vector<float> t(n);
+    vector<float> out(n);
+    for (size_t i = 0; i < n; ++i) {
+        t[i] = static_cast<float>(i) / static_cast<float>(n - 1);
+    }
+    for (auto fn : curves) {
+        auto id = easing::easing_id(fn);
+        ASSERT_NE(easing::EasingId::Custom, id);
+        easing::bulk_easing(id)(t.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_NEAR(fn(t[i]), out[i], 1e-5f) << "curve " << static_cast<int>(id) << " t " << t[i];
+        }
+    }
+    // Expo and elastic keep their exact endpoints
+    float ends[] = {0.f, 1.f};
+    float eased[2];
+    easing::bulk::in_elastic(ends, eased, 2);
+    EXPECT_EQ(0.f, eased[0]);
+    EXPECT_EQ(1.f, eased[1]);
+    easing::bulk::out_expo(ends, eased, 2);
+    EXPECT_EQ(1.f, eased[1]);
+}
+
+TEST(Easing, LutMatchesFunction)
+{
+    easing::EasingLut cubic(easing::in_out_cubic);
+    easing::EasingLut elastic(easing::out_elastic);
+    EXPECT_EQ(easing::EasingLut::default_size, cubic.size());
+    for (int i = 0; i <= 1000; ++i) {
+        float t = static_cast<float>(i) / 1000.f;
+        EXPECT_NEAR(easing::in_out_cubic(t), cubic(t), 3e-5f);
+        EXPECT_NEAR(easing::out_elastic(t), elastic(t), 2e-3f);
+    }
+    EXPECT_FLOAT_EQ(1.f, cubic(2.f)); // Clamped
+}
+
 // ============================================================================
 // Interpolator trait tests
 // ============================================================================
@@ -148,6 +205,28 @@ TEST(InterpolatorTrait, CustomSpecialization)
     EXPECT_FLOAT_EQ(10.f, mid.y);
 }
 
+TEST(InterpolatorTrait, BulkMatchesSingle)
+{
+    float from[] = {0.f, 10.f, -4.f, 1.f, 2.f};
+    float to[] = {100.f, 20.f, 4.f, 1.f, 0.f};
+    float t[] = {0.5f, 0.25f, 1.f, 0.3f, 0.75f};
+    float out[5] = {};
+    detail::typed_bulk_interpolator<float>(from, to, t, out, 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(interpolator_trait<float>::interpolate(from[i], to[i], t[i]), out[i]);
+    }
+
+    Vec2 va[] = {{0.f, 0.f}, {1.f, 1.f}};
+    Vec2 vb[] = {{10.f, 20.f}, {3.f, 5.f}};
+    float vt[] = {0.5f, 0.5f};
+    Vec2 vout[2];
+    bulk_interpolator_trait<Vec2>::interpolate(va, vb, vt, vout, 2);
+    EXPECT_FLOAT_EQ(5.f, vout[0].x);
+    EXPECT_FLOAT_EQ(10.f, vout[0].y);
+    EXPECT_FLOAT_EQ(2.f, vout[1].x);
+    EXPECT_FLOAT_EQ(3.f, vout[1].y);
+}
+
 // ============================================================================
 // Plugin / Animator tests (require velk_animator.dll)
 // ============================================================================
@@ -339,6 +418,248 @@ TEST_F(AnimatorTest, MultipleAnimations)
     EXPECT_FLOAT_EQ(100.f, prop_.get_value());
 }
 
+TEST_F(AnimatorTest, DestroyedAnimationLeavesAnimator)
+{
+    vector<Animation> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(create_tween(*animator_, 0.f, 1.f, sec(1.f)));
+        handles.back().play();
+    }
+    animator_->add(handles[0].get_animation_interface()); // Already in
+    EXPECT_EQ(100u, animator_->count());
+    animator_->tick(dt(0.1f));
+    EXPECT_EQ(100u, animator_->active_count());
+
+    handles.erase(handles.begin(), handles.begin() + 60);
+    EXPECT_EQ(40u, animator_->count());
+    EXPECT_EQ(40u, animator_->active_count());
+    animator_->tick(dt(0.1f));
+    EXPECT_FLOAT_EQ(0.2f, handles[0].get_progress());
+
+    handles.clear();
+    EXPECT_EQ(0u, animator_->count());
+    animator_->tick(dt(0.1f));
+}
+
+TEST_F(AnimatorTest, AnimationReleasedDuringTick)
+{
+    auto prop2 = create_property<float>(0.f);
+    auto a = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    vector<Animation> others;
+    others.push_back(create_tween(*animator_, 0.f, 1.f, sec(1.f)));
+    others.back().play();
+
+    // The first animation's notification releases the second one before it is ticked
+    Callback onProgress([&]() { others.clear(); });
+    a.get_animation_interface()->progress().add_on_changed(onProgress);
+    animator_->tick(dt(0.5f));
+    flush();
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+    EXPECT_EQ(1u, animator_->count());
+}
+
+TEST_F(AnimatorTest, AnimationsReleasedOnAnotherThread)
+{
+    vector<Animation> handles;
+    for (int i = 0; i < 200; ++i) {
+        handles.push_back(create_tween(*animator_, 0.f, 1.f, sec(10.f)));
+        handles.back().play();
+    }
+    EXPECT_EQ(200u, animator_->active_count());
+
+    std::atomic<bool> done{false};
+    std::thread releaser([&] {
+        while (!handles.empty()) {
+            handles.pop_back();
+        }
+        done = true;
+    });
+    while (!done) {
+        animator_->tick(dt(0.001f));
+    }
+    releaser.join();
+    EXPECT_EQ(0u, animator_->count());
+    EXPECT_EQ(0u, animator_->active_count());
+    animator_->tick(dt(0.001f));
+    EXPECT_EQ(0u, animator_->count());
+}
+
+TEST_F(AnimatorTest, AnimationReleasedOnAnotherThreadDuringTick)
+{
+    auto tr = create_transition(prop_, sec(1.f));
+    tr.set_animator(interface_pointer_cast<IAnimator>(animatorObj_));
+    auto b = create_tween(*animator_, 0.f, 1.f, sec(1.f));
+    prop_.set_value(100.f);
+
+    // The transition fires on_changed during the tick. The release waits in the destructor
+    // until the tick no longer uses the animation.
+    std::thread releaser;
+    Callback onChanged([&]() {
+        if (b) {
+            releaser = std::thread([&] { b = {}; });
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    });
+    prop_.add_on_changed(onChanged);
+    EXPECT_EQ(2u, animator_->count());
+    animator_->tick(dt(0.5f));
+    ASSERT_TRUE(releaser.joinable());
+    releaser.join();
+    flush();
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+    EXPECT_EQ(1u, animator_->count());
+    animator_->tick(dt(0.1f));
+    EXPECT_EQ(1u, animator_->count());
+    prop_.remove_on_changed(onChanged);
+}
+
+TEST_F(AnimatorTest, ActiveCountFollowsPlayState)
+{
+    auto h = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    EXPECT_EQ(1u, animator_->active_count());
+    h.pause();
+    EXPECT_EQ(0u, animator_->active_count());
+    h.play();
+    EXPECT_EQ(1u, animator_->active_count());
+    h.stop();
+    EXPECT_EQ(0u, animator_->active_count());
+    animator_->remove(h.get_animation_interface());
+    h.play();
+    EXPECT_EQ(0u, animator_->active_count());
+    animator_->add(h.get_animation_interface());
+    EXPECT_EQ(1u, animator_->active_count());
+}
+
+TEST_F(AnimatorTest, FinishedAnimationIsTickedAfterRestart)
+{
+    auto h = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    animator_->tick(dt(1.f));
+    animator_->tick(dt(1.f)); // Idle animations are no longer visited
+    flush();
+    EXPECT_TRUE(h.is_finished());
+    EXPECT_EQ(0u, animator_->active_count());
+
+    h.restart();
+    EXPECT_EQ(1u, animator_->active_count());
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(25.f, prop_.get_value(), 0.1f);
+}
+
+TEST_F(AnimatorTest, AnimationInTwoAnimators)
+{
+    auto otherObj = instance().create<IObject>(ClassId::Animator);
+    auto* other = interface_cast<IAnimator>(otherObj);
+    auto h = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    other->add(h.get_animation_interface());
+    other->add(h.get_animation_interface());
+    EXPECT_EQ(1u, other->count());
+
+    animator_->tick(dt(0.25f));
+    other->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+
+    animator_->remove(h.get_animation_interface());
+    EXPECT_EQ(0u, animator_->count());
+    EXPECT_EQ(1u, other->count());
+    other->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(75.f, prop_.get_value(), 0.1f);
+}
+
+TEST_F(AnimatorTest, UpdatePolicyFrameInterval)
+{
+    auto h = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    auto other = create_property<float>(0.f);
+    create_tween(*animator_, other, 0.f, 100.f, sec(1.f));
+    UpdatePolicy policy;
+    policy.frameInterval = 2;
+    EXPECT_EQ(ReturnValue::Success, animator_->set_update_policy(h.get_animation_interface(), policy));
+
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_FLOAT_EQ(0.f, prop_.get_value());
+    EXPECT_NEAR(25.f, other.get_value(), 0.1f);
+
+    // The skipped time is caught up on the next evaluated tick
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+    EXPECT_NEAR(50.f, other.get_value(), 0.1f);
+
+    // A default policy removes the throttling
+    EXPECT_EQ(ReturnValue::Success, animator_->set_update_policy(h.get_animation_interface(), UpdatePolicy{}));
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(75.f, prop_.get_value(), 0.1f);
+
+    auto otherObj = instance().create<IObject>(ClassId::Animator);
+    auto unmanaged = create_tween(*interface_cast<IAnimator>(otherObj), other, 0.f, 1.f, sec(1.f));
+    EXPECT_EQ(ReturnValue::Fail, animator_->set_update_policy(unmanaged.get_animation_interface(), policy));
+}
+
+TEST_F(AnimatorTest, UpdatePolicyMinIntervalOnAnimator)
+{
+    create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    UpdatePolicy policy;
+    policy.minInterval = sec(0.3f);
+    animator_->set_update_policy(policy);
+
+    animator_->tick(dt(0.2f));
+    flush();
+    EXPECT_FLOAT_EQ(0.f, prop_.get_value());
+
+    animator_->tick(dt(0.2f));
+    flush();
+    EXPECT_NEAR(40.f, prop_.get_value(), 0.1f);
+
+    animator_->set_update_policy(UpdatePolicy{});
+    animator_->tick(dt(0.2f));
+    flush();
+    EXPECT_NEAR(60.f, prop_.get_value(), 0.1f);
+}
+
+TEST_F(AnimatorTest, UpdatePolicySuspendedByFlag)
+{
+    auto h = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    auto visible = create_property<bool>(false);
+    UpdatePolicy policy;
+    policy.enabled = visible.get_property_interface();
+    animator_->set_update_policy(h.get_animation_interface(), policy);
+
+    animator_->tick(dt(0.25f));
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_FLOAT_EQ(0.f, prop_.get_value());
+    EXPECT_EQ(1u, animator_->active_count());
+
+    visible.set_value(true);
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(75.f, prop_.get_value(), 0.1f);
+}
+
+TEST_F(AnimatorTest, UpdatePolicySuspendedByPredicate)
+{
+    auto h = create_tween(*animator_, prop_, 0.f, 100.f, sec(1.f));
+    bool visible = false;
+    UpdatePolicy policy;
+    policy.predicate = [](void* context) { return *static_cast<bool*>(context); };
+    policy.context = &visible;
+    animator_->set_update_policy(h.get_animation_interface(), policy);
+
+    animator_->tick(dt(0.5f));
+    flush();
+    EXPECT_FLOAT_EQ(0.f, prop_.get_value());
+
+    visible = true;
+    animator_->tick(dt(0.75f));
+    flush();
+    EXPECT_TRUE(h.is_finished());
+    EXPECT_FLOAT_EQ(100.f, prop_.get_value());
+}
+
 // ============================================================================
 // Playback control tests
 // ============================================================================
@@ -480,6 +801,35 @@ TEST_F(TrackTest, PerSegmentEasing)
     EXPECT_NEAR(25.f, prop_.get_value(), 0.1f);
 }
 
+TEST_F(TrackTest, CustomEasingThroughLut)
+{
+    static int calls = 0;
+    calls = 0;
+    auto custom = [](float t) {
+        ++calls;
+        return t * t * t * t;
+    };
+    animator_->set_easing_lut_size(64);
+    auto h = create_track(*animator_,
+                          prop_,
+                          vector<Keyframe<float>>{
+                              {sec(0.f), 0.f},
+                              {sec(1.f), 100.f, custom},
+                          });
+
+    animator_->tick(dt(0.5f));
+    flush();
+    EXPECT_NEAR(6.25f, prop_.get_value(), 0.05f);
+    int sampled = calls;
+    EXPECT_GE(sampled, 64);
+
+    // The table is reused by later ticks
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(31.64f, prop_.get_value(), 0.1f);
+    EXPECT_EQ(sampled, calls);
+}
+
 TEST_F(TrackTest, FinishesAtLastKeyframe)
 {
     auto h = create_track(*animator_,
@@ -509,6 +859,275 @@ TEST_F(TrackTest, SingleKeyframeFinishesImmediately)
     EXPECT_TRUE(h.is_finished());
 }
 
+TEST_F(TrackTest, BatchedScalarTypes)
+{
+    auto ip = create_property<int>(0);
+    auto dp = create_property<double>(0.);
+    auto ih = create_track(*animator_, ip, vector<Keyframe<int>>{{sec(0.f), 0}, {sec(1.f), 200}});
+    auto dh = create_track(
+        *animator_, dp, vector<Keyframe<double>>{{sec(0.f), 1.}, {sec(1.f), 3., easing::in_quad}});
+    auto fh = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 10.f}, {sec(1.f), 20.f}});
+
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_EQ(50, ip.get_value());
+    EXPECT_NEAR(1.125, dp.get_value(), 1e-6);
+    EXPECT_NEAR(12.5f, prop_.get_value(), 1e-4f);
+    EXPECT_NEAR(0.25f, fh.get_progress(), 1e-6f);
+
+    animator_->tick(dt(1.f));
+    flush();
+    EXPECT_EQ(200, ip.get_value());
+    EXPECT_DOUBLE_EQ(3., dp.get_value());
+    EXPECT_FLOAT_EQ(20.f, prop_.get_value());
+    EXPECT_TRUE(ih.is_finished());
+    EXPECT_TRUE(dh.is_finished());
+}
+
+TEST_F(TrackTest, BatchedTrackMultipleTargets)
+{
+    auto other = create_property<float>(0.f);
+    auto h = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 0.f}, {sec(1.f), 100.f}});
+    h.add_target(other);
+
+    animator_->tick(dt(0.5f));
+    flush();
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+    EXPECT_NEAR(50.f, other.get_value(), 0.1f);
+}
+
+TEST_F(TrackTest, BatchedTrackNotifiesWithWrittenValue)
+{
+    auto h = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 0.f}, {sec(1.f), 100.f}});
+    int changed = 0;
+    float seen = -1.f;
+    Callback onChanged([&]() {
+        ++changed;
+        seen = prop_.get_value();
+    });
+    prop_.add_on_changed(onChanged);
+
+    int stateChanged = 0;
+    float seenFromState = -1.f;
+    Callback onState([&]() {
+        ++stateChanged;
+        seenFromState = prop_.get_value();
+    });
+    h.get_animation_interface()->progress().add_on_changed(onState);
+
+    animator_->tick(dt(0.5f));
+    EXPECT_EQ(1, stateChanged);
+    EXPECT_NEAR(50.f, seenFromState, 0.1f); // the value is written before the track notifies
+    flush();
+    EXPECT_EQ(1, changed);
+    EXPECT_NEAR(50.f, seen, 0.1f);
+}
+
+TEST_F(TrackTest, LongTrackFollowsPlayhead)
+{
+    vector<Keyframe<float>> keyframes;
+    for (int i = 0; i <= 200; ++i) {
+        // Alternating slopes, so landing in a neighbouring segment gives a different value
+        keyframes.push_back({sec(static_cast<float>(i)), i % 2 ? 10.f : 0.f});
+    }
+    auto h = create_track(*animator_, prop_, keyframes);
+    auto expected = [](float t) {
+        int seg = static_cast<int>(t);
+        float frac = t - static_cast<float>(seg);
+        return seg % 2 ? 10.f - 10.f * frac : 10.f * frac;
+    };
+
+    float t = 0.f;
+    for (float step : {0.25f, 0.5f, 0.5f, 3.25f, 0.25f, 50.5f, 0.25f}) {
+        animator_->tick(dt(step));
+        flush();
+        t += step;
+        EXPECT_NEAR(expected(t), prop_.get_value(), 0.01f) << t;
+    }
+
+    // Seeking backwards and playing on from there
+    h.seek(0.1f);
+    flush();
+    EXPECT_NEAR(expected(20.f), prop_.get_value(), 0.01f);
+    animator_->tick(dt(1.5f));
+    flush();
+    EXPECT_NEAR(expected(21.5f), prop_.get_value(), 0.01f);
+}
+
+TEST_F(TrackTest, BakedTrackMatchesCurve)
+{
+    auto h = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 0.f}, {sec(1.f), 100.f, easing::in_out_expo}});
+    EXPECT_EQ(ReturnValue::InvalidArgument, h.bake(-1.f));
+    EXPECT_EQ(ReturnValue::Success, h.bake(1000.f));
+
+    float t = 0.f;
+    for (int i = 0; i < 70; ++i) {
+        animator_->tick(dt(0.013f));
+        flush();
+        t += 0.013f;
+        EXPECT_NEAR(100.f * easing::in_out_expo(t), prop_.get_value(), 0.05f) << t;
+    }
+    animator_->tick(dt(1.f));
+    flush();
+    EXPECT_FLOAT_EQ(100.f, prop_.get_value());
+}
+
+TEST_F(TrackTest, BakedTrackBlendsSamples)
+{
+    auto h = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 0.f}, {sec(1.f), 100.f, easing::in_quad}});
+    ASSERT_EQ(ReturnValue::Success, h.bake(2.f)); // Samples at 0, 0.5 and 1 s: 0, 25, 100
+
+    animator_->tick(dt(0.25f));
+    flush();
+    EXPECT_NEAR(12.5f, prop_.get_value(), 0.01f);
+    animator_->tick(dt(0.5f));
+    flush();
+    EXPECT_NEAR(62.5f, prop_.get_value(), 0.01f);
+
+    // Unbaking returns to exact evaluation
+    ASSERT_EQ(ReturnValue::Success, h.bake(0.f));
+    animator_->tick(dt(0.05f));
+    flush();
+    EXPECT_NEAR(64.f, prop_.get_value(), 0.01f);
+}
+
+TEST_F(TrackTest, BakedTrackAppliedOutsideTheBatch)
+{
+    auto h = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 0.f}, {sec(1.f), 100.f, easing::in_quad}});
+    ASSERT_EQ(ReturnValue::Success, h.bake(2.f)); // Samples at 0, 0.5 and 1 s: 0, 25, 100
+
+    // seek() evaluates through the regular path, which blends the same samples
+    h.seek(0.25f);
+    flush();
+    EXPECT_NEAR(12.5f, prop_.get_value(), 0.01f);
+    h.seek(0.75f);
+    flush();
+    EXPECT_NEAR(62.5f, prop_.get_value(), 0.01f);
+}
+
+TEST_F(TrackTest, BakeFailsWhileTheTableCannotBeUsed)
+{
+    auto obj = instance().create<IObject>(ClassId::AnimationTrack);
+    auto* anim = interface_cast<IAnimationTrack>(obj);
+    ASSERT_NE(nullptr, anim);
+    EXPECT_EQ(ReturnValue::Fail, anim->bake(60.f)); // No target, no keyframes
+    EXPECT_EQ(ReturnValue::Success, anim->bake(0.f));
+}
+
+TEST_F(TrackTest, BakedTrackRebuiltBySetKeyframes)
+{
+    auto h = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 0.f}, {sec(1.f), 100.f}});
+    ASSERT_EQ(ReturnValue::Success, h.bake(60.f));
+    vector<Keyframe<float>> keyframes{{sec(0.f), 0.f}, {sec(2.f), -50.f}};
+    h.set_keyframes<float>(keyframes);
+    h.restart();
+
+    animator_->tick(dt(1.f));
+    flush();
+    EXPECT_NEAR(-25.f, prop_.get_value(), 0.01f);
+}
+
+TEST_F(TrackTest, ThreadCount)
+{
+    EXPECT_EQ(1u, animator_->thread_count());
+    animator_->set_thread_count(4);
+    EXPECT_EQ(4u, animator_->thread_count());
+    animator_->set_thread_count(0);
+    EXPECT_EQ(1u, animator_->thread_count());
+}
+
+TEST_F(TrackTest, ParallelTickMatchesSerial)
+{
+    auto parallelObj = instance().create<IObject>(ClassId::Animator);
+    auto* parallel = interface_cast<IAnimator>(parallelObj);
+    ASSERT_TRUE(parallel);
+    parallel->set_thread_count(4);
+
+    constexpr int count = 500;
+    easing::EasingFn easings[] = {easing::linear, easing::in_quad, easing::out_cubic, easing::in_out_sine};
+    vector<Property<float>> serialProps;
+    vector<Property<double>> serialDoubles;
+    vector<Property<float>> parallelProps;
+    vector<Property<double>> parallelDoubles;
+    vector<Animation> handles;
+    vector<int> serialOrder;
+    vector<int> parallelOrder;
+    vector<Callback> callbacks;
+    for (int i = 0; i < count; ++i) {
+        float len = 0.5f + static_cast<float>(i % 7) * 0.25f;
+        auto ease = easings[i % 4];
+        auto sp = create_property<float>(0.f);
+        auto pp = create_property<float>(0.f);
+        auto sd = create_property<double>(0.0);
+        auto pd = create_property<double>(0.0);
+        handles.push_back(create_track(*animator_, sp, vector<Keyframe<float>>{{sec(0.f), 0.f},
+                                                                                {sec(len), float(i), ease}}));
+        handles.push_back(create_track(*parallel, pp, vector<Keyframe<float>>{{sec(0.f), 0.f},
+                                                                              {sec(len), float(i), ease}}));
+        handles.push_back(create_track(*animator_, sd, vector<Keyframe<double>>{{sec(0.f), 0.0},
+                                                                                 {sec(len), -double(i), ease}}));
+        handles.push_back(create_track(*parallel, pd, vector<Keyframe<double>>{{sec(0.f), 0.0},
+                                                                               {sec(len), -double(i), ease}}));
+        callbacks.emplace_back([&serialOrder, i]() { serialOrder.push_back(i); });
+        sp.add_on_changed(callbacks.back());
+        callbacks.emplace_back([&parallelOrder, i]() { parallelOrder.push_back(i); });
+        pp.add_on_changed(callbacks.back());
+        serialProps.push_back(sp);
+        parallelProps.push_back(pp);
+        serialDoubles.push_back(sd);
+        parallelDoubles.push_back(pd);
+    }
+
+    // Finishing tracks take the per-object path, interleaved with the batched ones
+    for (float step : {0.1f, 0.3f, 0.35f, 0.5f, 0.6f, 1.f}) {
+        animator_->tick(dt(step));
+        parallel->tick(dt(step));
+        flush();
+        for (int i = 0; i < count; ++i) {
+            ASSERT_EQ(serialProps[i].get_value(), parallelProps[i].get_value()) << i;
+            ASSERT_EQ(serialDoubles[i].get_value(), parallelDoubles[i].get_value()) << i;
+        }
+    }
+    EXPECT_FALSE(serialOrder.empty());
+    EXPECT_EQ(serialOrder, parallelOrder);
+}
+
+TEST_F(TrackTest, ParallelTickWithTwoTracksOnOneProperty)
+{
+    auto parallelObj = instance().create<IObject>(ClassId::Animator);
+    auto* parallel = interface_cast<IAnimator>(parallelObj);
+    ASSERT_TRUE(parallel);
+    parallel->set_thread_count(4);
+
+    // Two tracks per property, with the second one added far from the first so that a
+    // split by animation order alone would put them in different partitions
+    constexpr int count = 300;
+    vector<Property<float>> serialProps;
+    vector<Property<float>> parallelProps;
+    vector<Animation> handles;
+    for (int i = 0; i < count; ++i) {
+        serialProps.push_back(create_property<float>(0.f));
+        parallelProps.push_back(create_property<float>(0.f));
+    }
+    for (int pass = 0; pass < 2; ++pass) {
+        float to = pass ? -100.f : 100.f;
+        for (int i = 0; i < count; ++i) {
+            vector<Keyframe<float>> keys{{sec(0.f), 0.f}, {sec(1.f + 0.5f * pass), to + float(i), easing::in_quad}};
+            handles.push_back(create_track(*animator_, serialProps[i], keys));
+            handles.push_back(create_track(*parallel, parallelProps[i], keys));
+        }
+    }
+
+    for (float step : {0.1f, 0.2f, 0.3f, 0.6f, 1.f}) {
+        animator_->tick(dt(step));
+        parallel->tick(dt(step));
+        flush();
+        for (int i = 0; i < count; ++i) {
+            ASSERT_EQ(serialProps[i].get_value(), parallelProps[i].get_value()) << i;
+        }
+    }
+}
+
 // ============================================================================
 // Animation wrapper tests
 // ============================================================================
@@ -978,4 +1597,342 @@ TEST_F(AnimatorTest, AnimationTransientCleansUpOnHandleDrop)
     EXPECT_FLOAT_EQ(42.f, prop_.get_value());
 }
 
+// ============================================================================
+// Bulk interpolator tests
+// ============================================================================
+
+namespace {
+
+int g_vec2BulkCalls = 0;
+
+void counting_vec2_bulk(const void* from, const void* to, const float* t, void* out, size_t count)
+{
+    ++g_vec2BulkCalls;
+    detail::typed_bulk_interpolator<Vec2>(from, to, t, out, count);
+}
+
+void register_vec2(ITypeRegistry& types)
+{
+    types.register_type<ext::AnyValue<Vec2>>();
+    types.register_interpolator<Vec2>(&detail::typed_interpolator<Vec2>);
+    types.register_bulk_interpolator<Vec2>(&counting_vec2_bulk);
+    g_vec2BulkCalls = 0;
+}
+
+void unregister_vec2(ITypeRegistry& types)
+{
+    types.unregister_interpolator<Vec2>();
+    types.unregister_type<ext::AnyValue<Vec2>>();
+}
+
+} // namespace
+
+TEST_F(AnimatorPluginTest, BulkInterpolatorRegistry)
+{
+    auto& types = instance().type_registry();
+    EXPECT_NE(nullptr, types.find_bulk_interpolator(type_uid<float>()));
+    EXPECT_NE(nullptr, types.find_bulk_interpolator(type_uid<int64_t>()));
+    EXPECT_EQ(nullptr, types.find_bulk_interpolator(type_uid<Vec2>()));
+
+    EXPECT_TRUE(succeeded(register_typed_interpolator<Vec2>(types)));
+    EXPECT_NE(nullptr, types.find_interpolator(type_uid<Vec2>()));
+    EXPECT_NE(nullptr, types.find_bulk_interpolator(type_uid<Vec2>()));
+
+    // Re-registering the single-value interpolator keeps the bulk one of the same owner
+    auto bulk = types.find_bulk_interpolator(type_uid<Vec2>());
+    types.register_interpolator<Vec2>(&detail::typed_interpolator<Vec2>);
+    EXPECT_EQ(bulk, types.find_bulk_interpolator(type_uid<Vec2>()));
+
+    types.register_bulk_interpolator<Vec2>(&counting_vec2_bulk);
+    EXPECT_EQ(&counting_vec2_bulk, types.find_bulk_interpolator(type_uid<Vec2>()));
+
+    EXPECT_EQ(ReturnValue::Success, types.unregister_interpolator<Vec2>());
+    EXPECT_EQ(nullptr, types.find_interpolator(type_uid<Vec2>()));
+    EXPECT_EQ(nullptr, types.find_bulk_interpolator(type_uid<Vec2>()));
+}
+
+TEST_F(TrackTest, CustomTypeUsesBulkInterpolator)
+{
+    auto& types = instance().type_registry();
+    register_vec2(types);
+    {
+        auto a = create_property<Vec2>({});
+        auto b = create_property<Vec2>({});
+        auto ha = create_track(*animator_, a, vector<Keyframe<Vec2>>{{sec(0.f), {}}, {sec(1.f), {10.f, 20.f}}});
+        auto hb = create_track(*animator_, b, vector<Keyframe<Vec2>>{{sec(0.f), {}}, {sec(1.f), {-4.f, 8.f}}});
+
+        animator_->tick(dt(0.5f));
+        flush();
+        EXPECT_EQ(1, g_vec2BulkCalls); // Both tracks in one call
+        EXPECT_FLOAT_EQ(5.f, a.get_value().x);
+        EXPECT_FLOAT_EQ(10.f, a.get_value().y);
+        EXPECT_FLOAT_EQ(-2.f, b.get_value().x);
+        EXPECT_FLOAT_EQ(4.f, b.get_value().y);
+    }
+    unregister_vec2(types);
+}
+
+namespace {
+
+/** @brief Float interpolator that jumps to the end value halfway through. */
+ReturnValue snapping_float(const IAny& from, const IAny& to, float t, IAny& result)
+{
+    float a{}, b{};
+    if (failed(from.get_data(&a, sizeof(a), type_uid<float>())) ||
+        failed(to.get_data(&b, sizeof(b), type_uid<float>()))) {
+        return ReturnValue::Fail;
+    }
+    float r = t < 0.5f ? a : b;
+    return result.set_data(&r, sizeof(r), type_uid<float>());
+}
+
+} // namespace
+
+TEST_F(TrackTest, CustomScalarInterpolatorAppliesToBatchedTracks)
+{
+    auto& types = instance().type_registry();
+    // The built-in float interpolators belong to the animator plugin, so replacing the
+    // single-value one from the application drops the plugin's bulk one
+    ASSERT_EQ(ReturnValue::Success, types.register_interpolator<float>(&snapping_float));
+    EXPECT_EQ(nullptr, types.find_bulk_interpolator(type_uid<float>()));
+    {
+        auto other = create_property<float>(0.f);
+        auto ha = create_track(*animator_, prop_, vector<Keyframe<float>>{{sec(0.f), 10.f}, {sec(1.f), 100.f}});
+        auto hb = create_track(*animator_, other, vector<Keyframe<float>>{{sec(0.f), 1.f}, {sec(1.f), 2.f}});
+
+        animator_->tick(dt(0.25f));
+        flush();
+        EXPECT_FLOAT_EQ(10.f, prop_.get_value());
+        EXPECT_FLOAT_EQ(1.f, other.get_value());
+
+        animator_->tick(dt(0.5f));
+        flush();
+        EXPECT_FLOAT_EQ(100.f, prop_.get_value());
+        EXPECT_FLOAT_EQ(2.f, other.get_value());
+    }
+    EXPECT_TRUE(succeeded(register_typed_interpolator<float>(types)));
+    EXPECT_NE(nullptr, types.find_bulk_interpolator(type_uid<float>()));
+}
+
+TEST_F(ImplicitAnimationTest, RetargetFromOtherThread)
+{
+    auto tr = create_transition(prop_, sec(0.1f));
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 1; i <= 5000; ++i) {
+            prop_.set_value(static_cast<float>(i));
+        }
+        done = true;
+    });
+    while (!done) {
+        advance(0.01f);
+        float v = prop_.get_value();
+        EXPECT_GE(v, 0.f);
+        EXPECT_LE(v, 5000.f);
+    }
+    writer.join();
+    advance(0.01f);
+    advance(1.f);
+    EXPECT_FLOAT_EQ(5000.f, prop_.get_value());
+}
+
+namespace {
+
+/** @brief Too large for the two-word pending stash of a transition. */
+struct Wide
+{
+    double v[4] = {};
+};
+
+} // namespace
+
+namespace velk {
+template <>
+struct interpolator_trait<Wide>
+{
+    static Wide interpolate(const Wide& a, const Wide& b, float t)
+    {
+        Wide r;
+        for (int i = 0; i < 4; ++i) {
+            r.v[i] = a.v[i] + (b.v[i] - a.v[i]) * t;
+        }
+        return r;
+    }
+};
+} // namespace velk
+
+TEST_F(ImplicitAnimationTest, RetargetLargeValueFromOtherThread)
+{
+    auto& types = instance().type_registry();
+    types.register_type<ext::AnyValue<Wide>>();
+    register_typed_interpolator<Wide>(types);
+    {
+        auto wide = create_property<Wide>({});
+        auto tr = create_transition(wide, sec(0.1f));
+        std::atomic<bool> done{false};
+        std::thread writer([&] {
+            for (int i = 1; i <= 2000; ++i) {
+                double d = i;
+                wide.set_value(Wide{{d, d, d, d}});
+            }
+            done = true;
+        });
+        while (!done) {
+            advance(0.01f);
+            // A torn target would make the lanes differ
+            auto v = wide.get_value();
+            EXPECT_EQ(v.v[0], v.v[1]);
+            EXPECT_EQ(v.v[0], v.v[3]);
+        }
+        writer.join();
+        advance(0.01f);
+        advance(1.f);
+        EXPECT_DOUBLE_EQ(2000., wide.get_value().v[2]);
+        tr.remove();
+    }
+    types.unregister_interpolator<Wide>();
+    types.unregister_type<ext::AnyValue<Wide>>();
+}
+
+TEST_F(ImplicitAnimationTest, TransitionOnOwnAnimatorClock)
+{
+    auto animator = create_animator();
+    auto tr = create_transition(prop_, sec(1.f));
+    tr.set_animator(animator);
+    EXPECT_EQ(1u, animator->count());
+    animator->set_time_scale(2.f);
+
+    prop_.set_value(100.f);
+    advance(0.25f);
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+
+    // A paused clock does not advance, and does not catch up after resuming
+    animator->set_paused(true);
+    advance(0.25f);
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+    animator->set_paused(false);
+    advance(0.125f);
+    EXPECT_NEAR(75.f, prop_.get_value(), 0.1f);
+
+    // Moving the transition back to the default animator keeps it running
+    tr.set_animator(nullptr);
+    EXPECT_EQ(0u, animator->count());
+    advance(0.25f);
+    EXPECT_NEAR(100.f, prop_.get_value(), 0.1f);
+}
+
+TEST_F(ImplicitAnimationTest, AnimatorsTickByPriority)
+{
+    auto low = create_animator(-1);
+    auto high = create_animator(1);
+    auto lowProp = create_property<float>(0.f);
+    vector<int> order;
+    auto a = create_tween(*low, lowProp, 0.f, 100.f, sec(1.f));
+    auto b = create_tween(*high, prop_, 0.f, 100.f, sec(1.f));
+    Callback onLow([&]() { order.push_back(-1); });
+    Callback onHigh([&]() { order.push_back(1); });
+    a.get_animation_interface()->progress().add_on_changed(onLow);
+    b.get_animation_interface()->progress().add_on_changed(onHigh);
+
+    advance(0.25f);
+    ASSERT_EQ(2u, order.size());
+    EXPECT_EQ(1, order[0]);
+    EXPECT_EQ(-1, order[1]);
+
+    // A released animator is no longer ticked
+    low.reset();
+    advance(0.25f);
+    EXPECT_EQ(3u, order.size());
+}
+
+TEST_F(ImplicitAnimationTest, ResumedAnimatorKeepsItsPlaceInTheTickOrder)
+{
+    auto first = create_animator();
+    auto second = create_animator();
+    auto otherProp = create_property<float>(0.f);
+    vector<int> order;
+    auto a = create_tween(*first, prop_, 0.f, 100.f, sec(1.f));
+    auto b = create_tween(*second, otherProp, 0.f, 100.f, sec(1.f));
+    Callback onFirst([&]() { order.push_back(1); });
+    Callback onSecond([&]() { order.push_back(2); });
+    a.get_animation_interface()->progress().add_on_changed(onFirst);
+    b.get_animation_interface()->progress().add_on_changed(onSecond);
+
+    // A paused animator leaves the tick list and returns to its place when it resumes
+    first->set_paused(true);
+    advance(0.25f);
+    ASSERT_EQ(1u, order.size());
+    EXPECT_EQ(2, order[0]);
+    EXPECT_FLOAT_EQ(0.f, prop_.get_value());
+
+    first->set_paused(false);
+    order.clear();
+    advance(0.25f);
+    ASSERT_EQ(2u, order.size());
+    EXPECT_EQ(1, order[0]);
+    EXPECT_EQ(2, order[1]);
+    EXPECT_NEAR(25.f, prop_.get_value(), 0.1f);
+
+    // Releasing a paused animator, or pausing it again, is safe
+    second->set_paused(true);
+    second.reset();
+    first->set_paused(true);
+    first->set_paused(false);
+    advance(0.25f);
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+}
+
+TEST_F(ImplicitAnimationTest, FrameBudgetDefersLowPriorityAnimators)
+{
+    auto* ap = get_or_load_plugin<IAnimatorPlugin>(PluginId::AnimatorPlugin);
+    ASSERT_NE(nullptr, ap);
+    auto high = create_animator(10);
+    auto low = create_animator(-10);
+    auto lowProp = create_property<float>(0.f);
+    auto a = create_tween(*high, prop_, 0.f, 100.f, sec(1.f));
+    auto b = create_tween(*low, lowProp, 0.f, 100.f, sec(1.f));
+    Callback slow([]() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    a.get_animation_interface()->progress().add_on_changed(slow);
+    ap->set_frame_budget(Duration::from_milliseconds(1.f));
+
+    advance(0.25f);
+    EXPECT_NEAR(25.f, prop_.get_value(), 0.1f);
+    EXPECT_FLOAT_EQ(0.f, lowProp.get_value());
+
+    // Deferred animators are not deferred twice, and catch up on the missed time
+    advance(0.25f);
+    EXPECT_NEAR(50.f, prop_.get_value(), 0.1f);
+    EXPECT_NEAR(50.f, lowProp.get_value(), 0.1f);
+
+    ap->set_frame_budget({});
+    advance(0.25f);
+    EXPECT_NEAR(75.f, lowProp.get_value(), 0.1f);
+}
+
+TEST_F(ImplicitAnimationTest, MultiTargetTransitionUsesBulkInterpolator)
+{
+    auto& types = instance().type_registry();
+    register_vec2(types);
+    {
+        auto a = create_property<Vec2>({});
+        auto b = create_property<Vec2>({});
+        auto tr = create_transition(sec(1.f));
+        tr.add_target(a);
+        tr.add_target(b);
+        a.set_value({10.f, 0.f});
+        b.set_value({0.f, 10.f});
+
+        advance(0.5f);
+        EXPECT_EQ(1, g_vec2BulkCalls);
+        EXPECT_NEAR(5.f, a.get_value().x, 0.01f);
+        EXPECT_NEAR(5.f, b.get_value().y, 0.01f);
+
+        advance(0.5f);
+        EXPECT_FLOAT_EQ(10.f, a.get_value().x);
+        EXPECT_FLOAT_EQ(10.f, b.get_value().y);
+        tr.remove();
+    }
+    unregister_vec2(types);
+}
+
 #endif // TEST_ANIMATOR_DLL_PATH
@@ -87,6 +87,21 @@ TEST(AnyRef, CloneIsIndependent)
     EXPECT_FLOAT_EQ(clonedVal, 42.f);
 }
 
+TEST(AnyRef, DataPointerIsTarget)
+{
+    float storage = 1.f;
+    ext::AnyRef<float> ref(&storage);
+    EXPECT_EQ(ref.get_data_pointer(type_uid<float>()), &storage);
+    EXPECT_EQ(ref.get_data_pointer(type_uid<int>()), nullptr);
+
+    ext::AnyValue<int> value;
+    auto* p = static_cast<int*>(value.get_data_pointer(type_uid<int>()));
+    ASSERT_NE(p, nullptr);
+    *p = 5;
+    EXPECT_EQ(value.get_value(), 5);
+    EXPECT_EQ(value.get_data_pointer(type_uid<float>()), nullptr);
+}
+
 TEST(AnyValue, SetSameValueReturnsNothingToDo)
 {
     ext::AnyValue<int> a;
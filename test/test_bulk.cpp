@@ -0,0 +1,205 @@
+#include <velk/api/bulk.h>
+#include <velk/api/callback.h>
+#include <velk/api/hive/object_hive.h>
+#include <velk/api/state.h>
+#include <velk/api/velk.h>
+#include <velk/ext/object.h>
+#include <velk/interface/hive/intf_hive_store.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace velk;
+
+namespace {
+
+class IBulkPoint : public Interface<IBulkPoint>
+{
+public:
+    VELK_INTERFACE(
+        (PROP, float, x, 0.f),
+        (PROP, float, y, 0.f),
+        (RPROP, int, id, 7)
+    )
+};
+
+class IBulkOther : public Interface<IBulkOther>
+{
+public:
+    VELK_INTERFACE(
+        (PROP, int, count, 0),
+        (PROP, float, x, 0.f)
+    )
+};
+
+class BulkPoint : public ext::Object<BulkPoint, IBulkPoint>
+{};
+
+// Declares "x" in a different interface, behind another State.
+class BulkOther : public ext::Object<BulkOther, IBulkOther>
+{};
+
+class BulkTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        register_type<BulkPoint>(instance());
+        register_type<BulkOther>(instance());
+    }
+
+    void TearDown() override
+    {
+        unregister_type<BulkOther>(instance());
+        unregister_type<BulkPoint>(instance());
+    }
+
+    std::vector<IObject::Ptr> make_points(int n)
+    {
+        std::vector<IObject::Ptr> objects;
+        for (int i = 0; i < n; ++i) {
+            auto obj = instance().create<IObject>(BulkPoint::class_id());
+            write_state<IBulkPoint>(obj.get())->x = static_cast<float>(i);
+            objects.push_back(obj);
+        }
+        return objects;
+    }
+};
+
+array_view<IObject::Ptr> view(const std::vector<IObject::Ptr>& v)
+{
+    return {v.data(), v.size()};
+}
+
+} // namespace
+
+TEST_F(BulkTest, GatherByMember)
+{
+    auto objects = make_points(5);
+    std::vector<float> xs(objects.size(), -1.f);
+    EXPECT_EQ(gather<IBulkPoint>(view(objects), &IBulkPoint::State::x, xs.data()), 5u);
+    for (size_t i = 0; i < xs.size(); ++i) {
+        EXPECT_FLOAT_EQ(xs[i], static_cast<float>(i));
+    }
+}
+
+TEST_F(BulkTest, ScatterByMember)
+{
+    auto objects = make_points(4);
+    float ys[] = {1.f, 2.f, 3.f, 4.f};
+    EXPECT_EQ(scatter<IBulkPoint>(view(objects), &IBulkPoint::State::y, ys), 4u);
+    for (size_t i = 0; i < objects.size(); ++i) {
+        EXPECT_FLOAT_EQ(interface_cast<IBulkPoint>(objects[i])->y().get_value(), ys[i]);
+    }
+}
+
+TEST_F(BulkTest, MixedClassesAndNulls)
+{
+    auto point = instance().create<IObject>(BulkPoint::class_id());
+    auto other = instance().create<IObject>(BulkOther::class_id());
+    write_state<IBulkPoint>(point.get())->x = 1.f;
+    write_state<IBulkOther>(other.get())->x = 2.f;
+    IObject* objects[] = {point.get(), nullptr, other.get(), point.get()};
+
+    float xs[4] = {-1.f, -1.f, -1.f, -1.f};
+    EXPECT_EQ(gather<IBulkPoint>(array_view<IObject*>(objects, 4), &IBulkPoint::State::x, xs), 2u);
+    EXPECT_FLOAT_EQ(xs[0], 1.f);
+    EXPECT_FLOAT_EQ(xs[1], -1.f);
+    EXPECT_FLOAT_EQ(xs[2], -1.f);
+    EXPECT_FLOAT_EQ(xs[3], 1.f);
+
+    // By name, "x" resolves to the State of whichever interface declares it
+    EXPECT_EQ(gather(array_view<IObject*>(objects, 4), "x", xs), 3u);
+    EXPECT_FLOAT_EQ(xs[2], 2.f);
+
+    float values[] = {5.f, 0.f, 6.f, 7.f};
+    EXPECT_EQ(scatter(array_view<IObject*>(objects, 4), "x", values), 3u);
+    EXPECT_FLOAT_EQ(read_state<IBulkPoint>(point.get())->x, 7.f);
+    EXPECT_FLOAT_EQ(read_state<IBulkOther>(other.get())->x, 6.f);
+}
+
+TEST_F(BulkTest, ByNameChecksTypeAndReadOnly)
+{
+    auto objects = make_points(2);
+    int ids[2] = {0, 0};
+    EXPECT_EQ(gather(view(objects), "id", ids), 2u);
+    EXPECT_EQ(ids[0], 7);
+
+    int new_ids[2] = {1, 2};
+    EXPECT_EQ(scatter(view(objects), "id", new_ids), 0u);
+    EXPECT_EQ(read_state<IBulkPoint>(objects[0].get())->id, 7);
+
+    double wrong[2] = {};
+    EXPECT_EQ(gather(view(objects), "x", wrong), 0u);
+    EXPECT_EQ(gather(view(objects), "missing", ids), 0u);
+}
+
+TEST_F(BulkTest, ScatterNotifyModes)
+{
+    auto objects = make_points(3);
+    int notified = 0;
+    float seen_last = 0.f;
+    Callback onChanged([&]() {
+        ++notified;
+        seen_last = read_state<IBulkPoint>(objects.back().get())->x;
+    });
+    for (auto& obj : objects) {
+        interface_cast<IBulkPoint>(obj)->x().add_on_changed(onChanged);
+    }
+
+    float values[] = {10.f, 11.f, 12.f};
+    notified = 0;
+    scatter<IBulkPoint>(view(objects), &IBulkPoint::State::x, values);
+    EXPECT_EQ(notified, 3);
+    EXPECT_FLOAT_EQ(seen_last, 12.f); // last handler runs after the last write
+
+    float batched[] = {20.f, 21.f, 22.f};
+    notified = 0;
+    seen_last = 0.f;
+    scatter<IBulkPoint>(view(objects), &IBulkPoint::State::x, batched, ScatterNotify::Batched);
+    EXPECT_EQ(notified, 3);
+    EXPECT_FLOAT_EQ(seen_last, 22.f);
+
+    float silent[] = {30.f, 31.f, 32.f};
+    notified = 0;
+    scatter(view(objects), "x", silent, ScatterNotify::None);
+    EXPECT_EQ(notified, 0);
+    EXPECT_FLOAT_EQ(interface_cast<IBulkPoint>(objects[1])->x().get_value(), 31.f);
+}
+
+TEST_F(BulkTest, BatchedNotifiesAfterAllWrites)
+{
+    auto objects = make_points(3);
+    float first_seen_last = -1.f;
+    Callback onChanged([&]() {
+        if (first_seen_last < 0.f) {
+            first_seen_last = read_state<IBulkPoint>(objects.back().get())->x;
+        }
+    });
+    interface_cast<IBulkPoint>(objects.front())->x().add_on_changed(onChanged);
+    first_seen_last = -1.f;
+
+    float values[] = {40.f, 41.f, 42.f};
+    scatter<IBulkPoint>(view(objects), &IBulkPoint::State::x, values, ScatterNotify::Batched);
+    EXPECT_FLOAT_EQ(first_seen_last, 42.f);
+}
+
+TEST_F(BulkTest, HiveObjects)
+{
+    auto store = instance().create<IHiveStore>(ClassId::HiveStore);
+    ASSERT_TRUE(store);
+    ObjectHive<> hive(*store, BulkPoint::class_id());
+    std::vector<IObject::Ptr> objects;
+    for (int i = 0; i < 8; ++i) {
+        objects.push_back(hive.add());
+    }
+    std::vector<float> values(objects.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i) * 2.f;
+    }
+    EXPECT_EQ(scatter<IBulkPoint>(view(objects), &IBulkPoint::State::x, values.data()), 8u);
+
+    std::vector<float> out(objects.size());
+    EXPECT_EQ(gather(view(objects), "x", out.data()), 8u);
+    EXPECT_EQ(out, values);
+}
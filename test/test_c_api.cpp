@@ -1,11 +1,16 @@
 #include <velk_c.h>
 
+#include <velk/api/callback.h>
 #include <velk/api/velk.h>
 #include <velk/ext/object.h>
 #include <velk/interface/intf_metadata.h>
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstring>
+#include <string>
+
 // Test interface: simple widget with a float and an event
 class ICApiWidget : public velk::Interface<ICApiWidget>
 {
@@ -248,6 +253,241 @@ TEST_F(CApi, PropertyOnChanged)
     velk_release(obj);
 }
 
+// Member ordinals
+
+TEST_F(CApi, ClassMemberEnumeration)
+{
+    auto cpp_uid = CApiWidget::class_id();
+    velk_uid class_id = {cpp_uid.hi, cpp_uid.lo};
+
+    size_t count = velk_class_member_count(class_id);
+    ASSERT_EQ(count, size_t(5));
+
+    bool sawWidth = false;
+    for (size_t i = 0; i < count; ++i) {
+        velk_member_info info;
+        ASSERT_EQ(velk_class_member(class_id, int32_t(i), &info), VELK_SUCCESS);
+        std::string name(info.name, info.name_length);
+        EXPECT_EQ(velk_resolve_member(class_id, name.c_str(), info.kind), int32_t(i));
+        if (name == "width") {
+            sawWidth = true;
+            EXPECT_EQ(info.kind, VELK_MEMBER_PROPERTY);
+            EXPECT_EQ(info.type.hi, VELK_TYPE_FLOAT.hi);
+            EXPECT_EQ(info.type.lo, VELK_TYPE_FLOAT.lo);
+            EXPECT_EQ(info.interface_id.hi, ICApiWidget::UID.hi);
+            EXPECT_EQ(info.interface_id.lo, ICApiWidget::UID.lo);
+        }
+    }
+    EXPECT_TRUE(sawWidth);
+
+    velk_member_info info;
+    EXPECT_EQ(velk_class_member(class_id, int32_t(count), &info), VELK_INVALID_ARG);
+    EXPECT_EQ(velk_class_member(class_id, -1, &info), VELK_INVALID_ARG);
+    EXPECT_EQ(velk_class_member_count({0, 0}), size_t(0));
+    EXPECT_EQ(velk_resolve_member(class_id, "width", VELK_MEMBER_EVENT), VELK_INVALID_ORDINAL);
+    EXPECT_EQ(velk_resolve_member(class_id, "missing", VELK_MEMBER_PROPERTY), VELK_INVALID_ORDINAL);
+    EXPECT_EQ(velk_resolve_member({0, 0}, "width", VELK_MEMBER_PROPERTY), VELK_INVALID_ORDINAL);
+}
+
+TEST_F(CApi, GetMembersByOrdinal)
+{
+    auto cpp_uid = CApiWidget::class_id();
+    velk_uid class_id = {cpp_uid.hi, cpp_uid.lo};
+    int32_t width = velk_resolve_member(class_id, "width", VELK_MEMBER_PROPERTY);
+    int32_t clicked = velk_resolve_member(class_id, "on_clicked", VELK_MEMBER_EVENT);
+    int32_t add = velk_resolve_member(class_id, "add", VELK_MEMBER_FUNCTION);
+    ASSERT_NE(width, VELK_INVALID_ORDINAL);
+    ASSERT_NE(clicked, VELK_INVALID_ORDINAL);
+    ASSERT_NE(add, VELK_INVALID_ORDINAL);
+
+    velk_object obj = velk_create(class_id, 0);
+    velk_property prop = velk_get_property_by_ordinal(obj, width);
+    ASSERT_NE(prop, nullptr);
+    velk_property_set_float(prop, 12.f);
+
+    // Same instance as the named lookup
+    velk_property named = velk_get_property(obj, "width");
+    EXPECT_EQ(prop, named);
+
+    velk_event evt = velk_get_event_by_ordinal(obj, clicked);
+    EXPECT_NE(evt, nullptr);
+    velk_function fn = velk_get_function_by_ordinal(obj, add);
+    EXPECT_NE(fn, nullptr);
+
+    // Wrong kind or out of range
+    EXPECT_EQ(velk_get_property_by_ordinal(obj, clicked), nullptr);
+    EXPECT_EQ(velk_get_event_by_ordinal(obj, width), nullptr);
+    EXPECT_EQ(velk_get_function_by_ordinal(obj, 100), nullptr);
+    EXPECT_EQ(velk_get_function_by_ordinal(obj, -1), nullptr);
+    EXPECT_EQ(velk_get_property_by_ordinal(nullptr, width), nullptr);
+
+    velk_release(fn);
+    velk_release(evt);
+    velk_release(named);
+    velk_release(prop);
+    velk_release(obj);
+}
+
+// State access
+
+TEST_F(CApi, DescribeAndMapState)
+{
+    auto cpp_uid = CApiWidget::class_id();
+    velk_uid class_id = {cpp_uid.hi, cpp_uid.lo};
+    velk_uid intf = {ICApiWidget::UID.hi, ICApiWidget::UID.lo};
+
+    ASSERT_EQ(velk_describe_state(class_id, intf, nullptr, 0), size_t(2));
+    velk_state_field fields[2];
+    ASSERT_EQ(velk_describe_state(class_id, intf, fields, 2), size_t(2));
+
+    EXPECT_EQ(std::string(fields[0].name, fields[0].name_length), "width");
+    EXPECT_EQ(fields[0].type.hi, VELK_TYPE_FLOAT.hi);
+    EXPECT_EQ(fields[0].type.lo, VELK_TYPE_FLOAT.lo);
+    EXPECT_EQ(fields[0].size, sizeof(float));
+    EXPECT_EQ(fields[0].offset, offsetof(ICApiWidget::State, width));
+    EXPECT_EQ(fields[0].kind, VELK_MEMBER_PROPERTY);
+    EXPECT_EQ(fields[0].ordinal, velk_resolve_member(class_id, "width", VELK_MEMBER_PROPERTY));
+    EXPECT_EQ(fields[0].read_only, 0);
+    EXPECT_EQ(std::string(fields[1].name, fields[1].name_length), "count");
+    EXPECT_EQ(fields[1].size, sizeof(int32_t));
+    EXPECT_EQ(fields[1].offset, offsetof(ICApiWidget::State, count));
+
+    velk_object obj = velk_create(class_id, 0);
+    auto* state = static_cast<char*>(velk_get_state(obj, intf));
+    ASSERT_NE(state, nullptr);
+    float width = 0.f;
+    std::memcpy(&width, state + fields[0].offset, sizeof(width));
+    EXPECT_FLOAT_EQ(width, 100.f);
+
+    velk_property prop = velk_get_property(obj, "width");
+    velk_event changed = velk_property_on_changed(prop);
+    int counter = 0;
+    velk_function handler = velk_create_callback(&on_changed_callback, &counter);
+    velk_event_add(changed, handler);
+
+    width = 55.f;
+    std::memcpy(state + fields[0].offset, &width, sizeof(width));
+    EXPECT_EQ(counter, 0);
+    EXPECT_EQ(velk_notify_state_changed(obj, intf), VELK_SUCCESS);
+    EXPECT_EQ(counter, 1);
+    float read = 0.f;
+    velk_property_get_float(prop, &read);
+    EXPECT_FLOAT_EQ(read, 55.f);
+
+    // Unknown interface or class
+    EXPECT_EQ(velk_get_state(obj, {1, 2}), nullptr);
+    EXPECT_EQ(velk_describe_state(class_id, {1, 2}, fields, 2), size_t(0));
+    EXPECT_EQ(velk_describe_state({0, 0}, intf, fields, 2), size_t(0));
+    EXPECT_EQ(velk_get_state(nullptr, intf), nullptr);
+    EXPECT_EQ(velk_notify_state_changed(nullptr, intf), VELK_INVALID_ARG);
+
+    velk_release(handler);
+    velk_release(changed);
+    velk_release(prop);
+    velk_release(obj);
+}
+
+// Batched property access
+
+static velk_object create_widget()
+{
+    auto cpp_uid = CApiWidget::class_id();
+    return velk_create({cpp_uid.hi, cpp_uid.lo}, 0);
+}
+
+TEST_F(CApi, PropertyGetSetMany)
+{
+    velk_object objs[3] = {create_widget(), create_widget(), create_widget()};
+    velk_property props[4] = {};
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_NE(objs[i], nullptr);
+        props[i] = velk_get_property(objs[i], "width");
+        ASSERT_NE(props[i], nullptr);
+    }
+    // props[3] stays NULL and is skipped
+
+    float values[4] = {1.f, 2.f, 3.f, 4.f};
+    EXPECT_EQ(velk_property_set_many(props, 4, values, sizeof(float), VELK_TYPE_FLOAT), size_t(3));
+
+    float out[4] = {0.f, 0.f, 0.f, -1.f};
+    EXPECT_EQ(velk_property_get_many(props, 4, out, sizeof(float), VELK_TYPE_FLOAT), size_t(3));
+    EXPECT_FLOAT_EQ(out[0], 1.f);
+    EXPECT_FLOAT_EQ(out[1], 2.f);
+    EXPECT_FLOAT_EQ(out[2], 3.f);
+    EXPECT_FLOAT_EQ(out[3], -1.f);
+
+    // Type mismatch transfers nothing
+    double d[3] = {};
+    EXPECT_EQ(velk_property_get_many(props, 3, d, sizeof(double), VELK_TYPE_DOUBLE), size_t(0));
+    EXPECT_EQ(velk_property_set_many(props, 3, d, sizeof(double), VELK_TYPE_DOUBLE), size_t(0));
+
+    for (int i = 0; i < 3; ++i) {
+        velk_release(props[i]);
+        velk_release(objs[i]);
+    }
+}
+
+TEST_F(CApi, GatherScatter)
+{
+    velk_object objs[3] = {create_widget(), nullptr, create_widget()};
+    ASSERT_NE(objs[0], nullptr);
+    ASSERT_NE(objs[2], nullptr);
+
+    int32_t values[3] = {5, 6, 7};
+    EXPECT_EQ(velk_scatter(objs, 3, "count", values, sizeof(int32_t), VELK_TYPE_INT32, VELK_NOTIFY_NONE),
+              size_t(2));
+
+    int32_t out[3] = {-1, -1, -1};
+    EXPECT_EQ(velk_gather(objs, 3, "count", out, sizeof(int32_t), VELK_TYPE_INT32), size_t(2));
+    EXPECT_EQ(out[0], 5);
+    EXPECT_EQ(out[1], -1);
+    EXPECT_EQ(out[2], 7);
+
+    // Visible through the property handles
+    velk_property prop = velk_get_property(objs[2], "count");
+    int32_t v = 0;
+    velk_property_get_int32(prop, &v);
+    EXPECT_EQ(v, 7);
+
+    // Unknown name, wrong type or wrong size read nothing
+    EXPECT_EQ(velk_gather(objs, 3, "missing", out, sizeof(int32_t), VELK_TYPE_INT32), size_t(0));
+    EXPECT_EQ(velk_gather(objs, 3, "count", out, sizeof(float), VELK_TYPE_FLOAT), size_t(0));
+    EXPECT_EQ(velk_gather(objs, 3, "count", out, sizeof(double), VELK_TYPE_INT32), size_t(0));
+
+    velk_release(prop);
+    velk_release(objs[0]);
+    velk_release(objs[2]);
+}
+
+TEST_F(CApi, ScatterNotifies)
+{
+    velk_object objs[2] = {create_widget(), create_widget()};
+    velk_property prop = velk_get_property(objs[1], "width");
+    velk_event changed = velk_property_on_changed(prop);
+    int counter = 0;
+    velk_function handler = velk_create_callback(&on_changed_callback, &counter);
+    velk_event_add(changed, handler);
+
+    float values[2] = {10.f, 20.f};
+    velk_scatter(objs, 2, "width", values, sizeof(float), VELK_TYPE_FLOAT, VELK_NOTIFY_IMMEDIATE);
+    EXPECT_EQ(counter, 1);
+    velk_scatter(objs, 2, "width", values, sizeof(float), VELK_TYPE_FLOAT, VELK_NOTIFY_BATCHED);
+    EXPECT_EQ(counter, 2);
+    velk_scatter(objs, 2, "width", values, sizeof(float), VELK_TYPE_FLOAT, VELK_NOTIFY_NONE);
+    EXPECT_EQ(counter, 2);
+    EXPECT_EQ(velk_scatter(objs, 2, "width", values, sizeof(float), VELK_TYPE_FLOAT, 7), size_t(0));
+
+    float w = 0.f;
+    velk_property_get_float(prop, &w);
+    EXPECT_FLOAT_EQ(w, 20.f);
+
+    velk_release(handler);
+    velk_release(changed);
+    velk_release(prop);
+    velk_release(objs[0]);
+    velk_release(objs[1]);
+}
+
 // Function invocation
 
 TEST_F(CApi, GetFunctionAndInvoke)
@@ -306,6 +546,177 @@ TEST_F(CApi, InvokeWithArgs)
     velk_release(obj);
 }
 
+TEST_F(CApi, InvokeWithInlineArgs)
+{
+    auto cpp_uid = CApiWidget::class_id();
+    velk_object obj = velk_create({cpp_uid.hi, cpp_uid.lo}, 0);
+    velk_function fn = velk_get_function(obj, "add");
+    ASSERT_NE(fn, nullptr);
+    auto* widget = static_cast<CApiWidget*>(velk::interface_cast<ICApiWidget>(reinterpret_cast<velk::IInterface*>(obj)));
+
+    velk_arg args[2];
+    args[0].type = VELK_TYPE_INT32;
+    args[0].value.i32 = 5;
+    args[1].type = VELK_TYPE_INT32;
+    args[1].value.i32 = 6;
+    EXPECT_EQ(velk_invoke_argv(fn, args, 2), VELK_SUCCESS);
+    EXPECT_EQ(widget->last_add_result, 11);
+
+    EXPECT_EQ(velk_invoke_i32x2(fn, 20, 22), VELK_SUCCESS);
+    EXPECT_EQ(widget->last_add_result, 42);
+
+    // Unsupported argument type
+    args[1].type = {1, 2};
+    EXPECT_EQ(velk_invoke_argv(fn, args, 2), VELK_INVALID_ARG);
+    EXPECT_EQ(velk_invoke_argv(nullptr, args, 2), VELK_INVALID_ARG);
+    EXPECT_EQ(velk_invoke_i32x2(nullptr, 1, 2), VELK_INVALID_ARG);
+
+    velk_release(fn);
+    velk_release(obj);
+}
+
+TEST_F(CApi, InlineArgsReachCallbacks)
+{
+    float received[3] = {};
+    auto fn = velk::Callback([&](velk::FnArgs args) -> velk::ReturnValue {
+        for (size_t i = 0; i < args.count && i < 3; ++i) {
+            args[i]->get_data(&received[i], sizeof(float), velk::type_uid<float>());
+        }
+        return velk::ReturnValue::Success;
+    });
+    velk::IFunction::Ptr ptr = fn;
+    auto handle = reinterpret_cast<velk_function>(static_cast<velk::IInterface*>(ptr.get()));
+
+    EXPECT_EQ(velk_invoke_f32x3(handle, 1.f, 2.f, 3.f), VELK_SUCCESS);
+    EXPECT_FLOAT_EQ(received[0], 1.f);
+    EXPECT_FLOAT_EQ(received[1], 2.f);
+    EXPECT_FLOAT_EQ(received[2], 3.f);
+
+    // More arguments than the inline limit
+    velk_arg many[10];
+    for (int i = 0; i < 10; ++i) {
+        many[i].type = VELK_TYPE_FLOAT;
+        many[i].value.f32 = float(i + 10);
+    }
+    EXPECT_EQ(velk_invoke_argv(handle, many, 10), VELK_SUCCESS);
+    EXPECT_FLOAT_EQ(received[0], 10.f);
+    EXPECT_FLOAT_EQ(received[2], 12.f);
+}
+
+// Hives
+
+TEST_F(CApi, HiveAddRemoveAndScanPages)
+{
+    auto cpp_uid = CApiWidget::class_id();
+    velk_uid class_id = {cpp_uid.hi, cpp_uid.lo};
+    velk_uid intf = {ICApiWidget::UID.hi, ICApiWidget::UID.lo};
+
+    velk_hive_store store = velk_create_hive_store();
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(velk_find_hive(store, class_id), nullptr);
+    velk_hive hive = velk_get_hive(store, class_id);
+    ASSERT_NE(hive, nullptr);
+    EXPECT_EQ(velk_hive_is_raw(hive), 0);
+    EXPECT_EQ(velk_hive_element_uid(hive).lo, class_id.lo);
+
+    velk_object first = velk_hive_add(hive);
+    ASSERT_NE(first, nullptr);
+    velk_object objs[19];
+    EXPECT_EQ(velk_hive_add_many(hive, 19, objs), size_t(19));
+    EXPECT_EQ(velk_hive_add_many(hive, 5, nullptr), size_t(5));
+    EXPECT_EQ(velk_hive_size(hive), size_t(25));
+    EXPECT_EQ(velk_hive_remove(hive, objs[0]), VELK_SUCCESS);
+    EXPECT_EQ(velk_hive_remove(hive, objs[0]), VELK_FAIL);
+    EXPECT_EQ(velk_hive_size(hive), size_t(24));
+
+    // Write through the state of each live slot, no callbacks involved
+    ptrdiff_t offset = velk_hive_state_offset(hive, intf);
+    ASSERT_GE(offset, 0);
+    EXPECT_EQ(velk_hive_state_offset(hive, {1, 2}), -1);
+    velk_hive_page pages[4];
+    size_t page_count = velk_hive_get_pages(hive, pages, 4);
+    ASSERT_EQ(page_count, velk_hive_page_count(hive));
+    size_t live = 0;
+    for (size_t p = 0; p < page_count; ++p) {
+        auto& page = pages[p];
+        live += page.live;
+        for (size_t i = 0; i < page.capacity; ++i) {
+            if (page.active_bits[i / 64] & (uint64_t(1) << (i % 64))) {
+                char* slot = static_cast<char*>(page.slots) + i * page.stride;
+                reinterpret_cast<ICApiWidget::State*>(slot + offset)->width = 7.f;
+            }
+        }
+    }
+    EXPECT_EQ(live, size_t(24));
+
+    float width = 0.f;
+    velk_property prop = velk_get_property(objs[5], "width");
+    velk_property_get_float(prop, &width);
+    EXPECT_FLOAT_EQ(width, 7.f);
+    velk_property removed = velk_get_property(objs[0], "width");
+    velk_property_get_float(removed, &width);
+    EXPECT_FLOAT_EQ(width, 100.f);
+
+    velk_hive_page page;
+    EXPECT_EQ(velk_hive_get_page(hive, 0, &page), VELK_SUCCESS);
+    EXPECT_EQ(page.slots, pages[0].slots);
+    EXPECT_EQ(velk_hive_get_page(hive, page_count, &page), VELK_INVALID_ARG);
+
+    velk_hive found = velk_find_hive(store, class_id);
+    EXPECT_EQ(found, hive);
+
+    velk_release(removed);
+    velk_release(prop);
+    velk_release(found);
+    for (auto* obj : objs) {
+        velk_release(obj);
+    }
+    velk_release(first);
+    velk_release(hive);
+    velk_release(store);
+}
+
+TEST_F(CApi, RawHiveAllocateAndScan)
+{
+    velk_hive_store store = velk_create_hive_store();
+    velk_uid id = {0x1234, 0x5678};
+    EXPECT_EQ(velk_get_raw_hive(store, id, sizeof(double), 3), nullptr);
+    velk_hive hive = velk_get_raw_hive(store, id, sizeof(double), alignof(double));
+    ASSERT_NE(hive, nullptr);
+    EXPECT_NE(velk_hive_is_raw(hive), 0);
+    EXPECT_EQ(velk_hive_add(hive), nullptr);
+    EXPECT_EQ(velk_hive_add_many(hive, 2, nullptr), size_t(0));
+
+    auto* a = static_cast<double*>(velk_hive_allocate(hive));
+    auto* b = static_cast<double*>(velk_hive_allocate(hive));
+    ASSERT_TRUE(a && b);
+    *a = 1.5;
+    *b = 2.5;
+
+    velk_hive_page page;
+    ASSERT_EQ(velk_hive_get_page(hive, 0, &page), VELK_SUCCESS);
+    EXPECT_EQ(page.stride, sizeof(double));
+    EXPECT_EQ(page.live, size_t(2));
+    EXPECT_EQ(page.active_words, (page.capacity + 63) / 64);
+    double sum = 0.0;
+    for (size_t i = 0; i < page.capacity; ++i) {
+        if (page.active_bits[i / 64] & (uint64_t(1) << (i % 64))) {
+            sum += *reinterpret_cast<double*>(static_cast<char*>(page.slots) + i * page.stride);
+        }
+    }
+    EXPECT_DOUBLE_EQ(sum, 4.0);
+
+    velk_hive_deallocate(hive, a);
+    EXPECT_EQ(velk_hive_size(hive), size_t(1));
+    velk_hive found = velk_find_raw_hive(store, id);
+    EXPECT_EQ(found, hive);
+
+    velk_hive_deallocate(hive, b);
+    velk_release(found);
+    velk_release(hive);
+    velk_release(store);
+}
+
 TEST_F(CApi, GetFunctionNotFound)
 {
     auto cpp_uid = CApiWidget::class_id();
@@ -347,6 +758,12 @@ TEST_F(CApi, NullHandlesReturnGracefully)
     EXPECT_EQ(uid.lo, uint64_t(0));
 
     EXPECT_EQ(velk_class_name(nullptr), nullptr);
+
+    EXPECT_EQ(velk_get_hive(nullptr, {0, 0}), nullptr);
+    EXPECT_EQ(velk_hive_add(nullptr), nullptr);
+    EXPECT_EQ(velk_hive_size(nullptr), size_t(0));
+    EXPECT_EQ(velk_hive_page_count(nullptr), size_t(0));
+    EXPECT_EQ(velk_hive_state_offset(nullptr, {0, 0}), -1);
 }
 
 // Type UID constants
@@ -4,6 +4,7 @@
 #include <velk/api/function.h>
 #include <velk/api/function_context.h>
 #include <velk/api/velk.h>
+#include <velk/ext/any.h>
 #include <velk/interface/intf_event.h>
 #include <velk/interface/intf_function.h>
 #include <velk/interface/types.h>
@@ -416,3 +417,47 @@ TEST(Callback, DeferredInvocationQueuesAndExecutesOnUpdate)
     instance().update();
     EXPECT_EQ(callCount, 1); // Now called
 }
+
+namespace {
+struct DeferredPoint
+{
+    float x;
+    float y;
+};
+} // namespace
+
+TEST(Callback, DeferredArgumentsCanBeKeptPastTheCall)
+{
+    IAny::Ptr keptFloat;
+    IAny::Ptr keptPoint;
+    Uid floatClass;
+    Uid pointClass;
+    Callback fn([&](FnArgs args) -> ReturnValue {
+        // Arguments are copies owned by the deferred task; clone() hands out an owned copy
+        floatClass = args[0]->get_class_uid();
+        pointClass = args[1]->get_class_uid();
+        keptFloat = args[0]->clone();
+        keptPoint = args[1]->clone();
+        return ReturnValue::Success;
+    });
+
+    instance().type_registry().register_type<ext::AnyValue<DeferredPoint>>();
+    Any<float> f(1.5f);
+    Any<DeferredPoint> p(DeferredPoint{2.f, 3.f});
+    const IAny* args[] = {f.get_any_interface(), p.get_any_interface()};
+    fn.invoke({args, 2}, Deferred);
+    instance().update();
+
+    // Inline and heap-held copies report the class of the AnyValue they were copied from
+    EXPECT_EQ(floatClass, f.get_any_interface()->get_class_uid());
+    EXPECT_EQ(pointClass, p.get_any_interface()->get_class_uid());
+    ASSERT_TRUE(keptFloat);
+    ASSERT_TRUE(keptPoint);
+    float fv = 0.f;
+    EXPECT_TRUE(succeeded(keptFloat->get_data(&fv, sizeof(fv), type_uid<float>())));
+    EXPECT_FLOAT_EQ(fv, 1.5f);
+    DeferredPoint pv{};
+    EXPECT_TRUE(succeeded(keptPoint->get_data(&pv, sizeof(pv), type_uid<DeferredPoint>())));
+    EXPECT_FLOAT_EQ(pv.y, 3.f);
+    instance().type_registry().unregister_type<ext::AnyValue<DeferredPoint>>();
+}
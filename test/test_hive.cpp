@@ -5,6 +5,7 @@
 #include <velk/interface/intf_metadata.h>
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -346,6 +347,40 @@ TEST_F(HiveTest, PageGrowth)
     EXPECT_EQ(100, count);
 }
 
+TEST_F(HiveTest, PageViewsCoverLiveObjects)
+{
+    auto hive = fresh_hive();
+    EXPECT_EQ(0u, hive->get_page_count());
+    HivePageView view;
+    EXPECT_FALSE(hive->get_page(0, view));
+
+    std::vector<IObject::Ptr> objs;
+    for (int i = 0; i < 20; ++i) {
+        objs.push_back(hive->add());
+    }
+    hive->remove(*objs[3]); // Zombie while referenced, must not show as live
+    ASSERT_EQ(2u, hive->get_page_count());
+
+    std::vector<IObject*> seen;
+    size_t live = 0;
+    for (size_t p = 0; p < hive->get_page_count(); ++p) {
+        ASSERT_TRUE(hive->get_page(p, view));
+        live += view.live;
+        for (size_t i = 0; i < view.capacity; ++i) {
+            if (view.active_bits[i / 64] & (uint64_t(1) << (i % 64))) {
+                seen.push_back(reinterpret_cast<IObject*>(static_cast<char*>(view.slots) + i * view.stride));
+            }
+        }
+    }
+    EXPECT_EQ(19u, live);
+    ASSERT_EQ(19u, seen.size());
+    for (int i = 0; i < 20; ++i) {
+        bool found = std::find(seen.begin(), seen.end(), objs[i].get()) != seen.end();
+        EXPECT_EQ(i != 3, found);
+    }
+    EXPECT_FALSE(hive->get_page(2, view));
+}
+
 TEST_F(HiveTest, ZombieToFreeTransition)
 {
     // Remove an object while an external ref exists. Verify the slot is
@@ -557,6 +592,28 @@ TEST_F(HiveTest, RawHiveAllocateDeallocate)
     EXPECT_TRUE(hive->empty());
 }
 
+TEST_F(HiveTest, RawHivePageView)
+{
+    auto hive = registry_->get_raw_hive<RawPoint>();
+    void* a = hive->allocate();
+    void* b = hive->allocate();
+    ASSERT_EQ(1u, hive->get_page_count());
+
+    HivePageView view;
+    ASSERT_TRUE(hive->get_page(0, view));
+    EXPECT_EQ(sizeof(RawPoint), view.stride);
+    EXPECT_EQ(2u, view.live);
+    EXPECT_EQ(a, view.slots);
+    EXPECT_EQ(b, static_cast<char*>(view.slots) + view.stride);
+    EXPECT_EQ(uint64_t(3), view.active_bits[0]);
+
+    hive->deallocate(a);
+    ASSERT_TRUE(hive->get_page(0, view));
+    EXPECT_EQ(1u, view.live);
+    EXPECT_EQ(uint64_t(2), view.active_bits[0]);
+    hive->deallocate(b);
+}
+
 TEST_F(HiveTest, RawHiveContains)
 {
     auto hive = registry_->get_raw_hive<RawPoint>();
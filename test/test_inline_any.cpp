@@ -0,0 +1,177 @@
+#include <velk/api/any.h>
+#include <velk/api/velk.h>
+#include <velk/inline_any.h>
+#include <velk/string.h>
+
+#include <gtest/gtest.h>
+
+using namespace velk;
+
+namespace {
+
+template <class T>
+T read(const IAny& any)
+{
+    T value{};
+    EXPECT_TRUE(succeeded(any.get_data(&value, sizeof(T), type_uid<T>())));
+    return value;
+}
+
+} // namespace
+
+TEST(InlineAny, DefaultIsEmpty)
+{
+    InlineAny<> any;
+    EXPECT_TRUE(any.empty());
+    EXPECT_FALSE(any);
+    EXPECT_FALSE(any.is_inline());
+    EXPECT_TRUE(any.get_compatible_types().empty());
+    EXPECT_EQ(any.get_data_size(type_uid<float>()), 0u);
+    EXPECT_FALSE(any.clone());
+}
+
+TEST(InlineAny, StoresTriviallyCopyableValueInline)
+{
+    Any<float> src(2.5f);
+    InlineAny<> any(src);
+    ASSERT_TRUE(any.is_inline());
+    ASSERT_EQ(any.get_compatible_types().size(), 1u);
+    EXPECT_EQ(any.get_compatible_types()[0], type_uid<float>());
+    EXPECT_EQ(any.get_data_size(type_uid<float>()), sizeof(float));
+    EXPECT_FLOAT_EQ(read<float>(any), 2.5f);
+
+    // The inline copy is independent of the source
+    src.set_value(1.f);
+    EXPECT_FLOAT_EQ(read<float>(any), 2.5f);
+
+    float f = 4.f;
+    EXPECT_EQ(any.set_data(&f, sizeof(f), type_uid<float>()), ReturnValue::Success);
+    EXPECT_EQ(any.set_data(&f, sizeof(f), type_uid<float>()), ReturnValue::NothingToDo);
+    EXPECT_FLOAT_EQ(read<float>(any), 4.f);
+
+    int wrong = 1;
+    EXPECT_EQ(any.set_data(&wrong, sizeof(wrong), type_uid<int>()), ReturnValue::Fail);
+}
+
+TEST(InlineAny, HasNoSelfButClonesToAnOwnedCopy)
+{
+    Any<float> src(2.5f);
+    InlineAny<> any(src);
+    ASSERT_TRUE(any.is_inline());
+    EXPECT_EQ(any.get_class_uid(), src.get_any_interface()->get_class_uid());
+    EXPECT_FALSE(any.get_self());
+
+    auto self = any.clone();
+    ASSERT_TRUE(self);
+    EXPECT_NE(self.get(), static_cast<IAny*>(&any));
+    EXPECT_FLOAT_EQ(read<float>(*self), 2.5f);
+
+    // The copy stays valid after the InlineAny changes
+    float f = 4.f;
+    any.set_data(&f, sizeof(f), type_uid<float>());
+    EXPECT_FLOAT_EQ(read<float>(*self), 2.5f);
+}
+
+TEST(InlineAny, FallsBackToHeapForLargeOrNonTrivialValues)
+{
+    InlineAny<> str{Any<string>(string("heap-held"))};
+    EXPECT_TRUE(str);
+    EXPECT_FALSE(str.is_inline());
+    EXPECT_EQ(Any<const string>(str).get_value(), string("heap-held"));
+
+    Any<double> d(4.);
+    InlineAny<sizeof(float)> narrow(d);
+    EXPECT_FALSE(narrow.is_inline());
+    EXPECT_DOUBLE_EQ(read<double>(narrow), 4.);
+
+    InlineAny<sizeof(double)> wide(d);
+    EXPECT_TRUE(wide.is_inline());
+    EXPECT_DOUBLE_EQ(read<double>(wide), 4.);
+}
+
+TEST(InlineAny, CloneCreatesOwnedCopy)
+{
+    InlineAny<> any{Any<int>(7)};
+    auto clone = any.clone();
+    ASSERT_TRUE(clone);
+    EXPECT_EQ(Any<const int>(clone).get_value(), 7);
+
+    int v = 8;
+    any.set_data(&v, sizeof(v), type_uid<int>());
+    EXPECT_EQ(Any<const int>(clone).get_value(), 7);
+}
+
+TEST(InlineAny, CopyFrom)
+{
+    InlineAny<> any;
+    EXPECT_TRUE(succeeded(any.copy_from(Any<int>(3))));
+    EXPECT_TRUE(any.is_inline());
+    EXPECT_EQ(read<int>(any), 3);
+
+    EXPECT_EQ(any.copy_from(Any<int>(5)), ReturnValue::Success);
+    EXPECT_EQ(read<int>(any), 5);
+    EXPECT_EQ(any.copy_from(Any<float>(1.f)), ReturnValue::Fail);
+
+    // Regular anys accept an InlineAny as the source
+    Any<int> dst;
+    EXPECT_EQ(dst.get_any_interface()->copy_from(any), ReturnValue::Success);
+    EXPECT_EQ(dst.get_value(), 5);
+}
+
+TEST(InlineAny, CopyAndMove)
+{
+    InlineAny<> a{Any<int>(1)};
+    InlineAny<> b(a);
+    EXPECT_TRUE(b.is_inline());
+    EXPECT_EQ(read<int>(b), 1);
+
+    InlineAny<> c(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(read<int>(c), 1);
+
+    InlineAny<> s{Any<string>(string("shared"))};
+    InlineAny<> s_copy;
+    s_copy = s;
+    auto text = string("changed");
+    s.set_data(&text, sizeof(text), type_uid<string>());
+    EXPECT_EQ(Any<const string>(s_copy).get_value(), string("shared"));
+
+    InlineAny<> s_moved;
+    s_moved = std::move(s);
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(Any<const string>(s_moved).get_value(), string("changed"));
+}
+
+TEST(InlineAny, AssignReplacesContents)
+{
+    InlineAny<> any{Any<string>(string("text"))};
+    EXPECT_FALSE(any.is_inline());
+    EXPECT_TRUE(any.assign(Any<double>(0.5)));
+    EXPECT_TRUE(any.is_inline());
+    EXPECT_DOUBLE_EQ(read<double>(any), 0.5);
+    any.reset();
+    EXPECT_TRUE(any.empty());
+}
+
+TEST(InlineAny, AssignData)
+{
+    InlineAny<sizeof(double)> any;
+    float f = 1.5f;
+    EXPECT_TRUE(any.assign_data(&f, sizeof(f), type_uid<float>(), &ext::AnyValue<float>::get_factory()));
+    EXPECT_TRUE(any.is_inline());
+    EXPECT_FLOAT_EQ(read<float>(any), 1.5f);
+    auto clone = any.clone();
+    ASSERT_TRUE(clone);
+    EXPECT_FLOAT_EQ(Any<const float>(clone).get_value(), 1.5f);
+
+    // Too large for the buffer
+    char big[16] = {};
+    EXPECT_FALSE(any.assign_data(big, sizeof(big), type_uid<float>()));
+    EXPECT_TRUE(any.empty());
+
+    // Without a factory the value cannot be cloned
+    int i = 3;
+    EXPECT_TRUE(any.assign_data(&i, sizeof(i), type_uid<int>()));
+    EXPECT_EQ(read<int>(any), 3);
+    EXPECT_FALSE(any.clone());
+}
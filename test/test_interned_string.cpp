@@ -0,0 +1,114 @@
+#include <velk/allocator.h>
+#include <velk/api/any.h>
+#include <velk/api/property.h>
+#include <velk/api/velk.h>
+#include <velk/interface/member_desc.h>
+#include <velk/interned_string.h>
+#include <velk/string.h>
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace velk;
+
+TEST(InternedString, DefaultIsEmpty)
+{
+    interned_string s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.size(), 0u);
+    EXPECT_STREQ(s.c_str(), "");
+    EXPECT_EQ(s, interned_string(""));
+    EXPECT_EQ(s.hash(), hash_string(""));
+}
+
+TEST(InternedString, SameCharactersSameHandle)
+{
+    string heap("interned-tag");
+    interned_string a("interned-tag");
+    interned_string b(heap);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.c_str(), b.c_str());
+    EXPECT_NE(a, interned_string("interned-other"));
+    EXPECT_EQ(a, string_view("interned-tag"));
+    EXPECT_STREQ(a.c_str(), "interned-tag");
+    EXPECT_EQ(a.hash(), hash_string("interned-tag"));
+}
+
+TEST(InternedString, HashIsConstexpr)
+{
+    static_assert(hash_string("value") != hash_string("values"));
+    constexpr MemberDesc desc = PropertyDesc("value");
+    static_assert(desc.nameHash == hash_string("value"));
+}
+
+TEST(InternedString, LongStrings)
+{
+    string long_str;
+    for (int i = 0; i < 200; ++i) {
+        long_str.append("0123456789");
+    }
+    interned_string a(long_str);
+    interned_string b(long_str);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.size(), long_str.size());
+    EXPECT_EQ(a.view(), string_view(long_str));
+}
+
+TEST(InternedString, TableStorageIsNotCountedAgainstAllocatorSlots)
+{
+    // Interned strings are never freed, so they must not hold allocator slots outstanding
+    auto metadata = instance().get_allocator_stats(AllocatorSlot::Metadata);
+    auto fallback = instance().get_allocator_stats(AllocatorSlot::Default);
+    char buf[32];
+    for (int i = 0; i < 256; ++i) {
+        int n = std::snprintf(buf, sizeof(buf), "untracked-entry-%d", i);
+        EXPECT_FALSE(interned_string(string_view(buf, static_cast<size_t>(n))).empty());
+    }
+    EXPECT_EQ(metadata.allocations, instance().get_allocator_stats(AllocatorSlot::Metadata).allocations);
+    EXPECT_EQ(fallback.allocations, instance().get_allocator_stats(AllocatorSlot::Default).allocations);
+}
+
+TEST(InternedString, ConcurrentInterning)
+{
+    constexpr int kThreads = 4;
+    constexpr int kStrings = 500;
+    std::vector<std::vector<interned_string>> results(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            char buf[32];
+            for (int i = 0; i < kStrings; ++i) {
+                int n = std::snprintf(buf, sizeof(buf), "concurrent-%d", i);
+                results[t].push_back(interned_string(string_view(buf, static_cast<size_t>(n))));
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (int t = 1; t < kThreads; ++t) {
+        for (int i = 0; i < kStrings; ++i) {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+    }
+}
+
+TEST(InternedString, AnyValueRoundTrip)
+{
+    Any<interned_string> any(interned_string("state-idle"));
+    ASSERT_TRUE(any);
+    EXPECT_EQ(any.get_value(), interned_string("state-idle"));
+
+    auto clone = any.clone();
+    ASSERT_TRUE(clone);
+    EXPECT_EQ(Any<const interned_string>(clone).get_value(), interned_string("state-idle"));
+}
+
+TEST(InternedString, PropertySetValue)
+{
+    auto p = create_property<interned_string>();
+    EXPECT_TRUE(p.get_value().empty());
+    p.set_value(interned_string("state-running"));
+    EXPECT_EQ(p.get_value(), interned_string("state-running"));
+}
@@ -904,6 +904,55 @@ TEST_F(ObjectTest, ResolveExistingSkipsStorageCreation)
     EXPECT_TRUE(meta->get_property("width", Resolve::Existing));
 }
 
+TEST_F(ObjectTest, GetMemberByIndexSharesInstanceWithNamedLookup)
+{
+    auto obj = instance().create<IObject>(TestWidget::class_id());
+    auto* meta = interface_cast<IMetadata>(obj);
+    ASSERT_NE(meta, nullptr);
+
+    auto members = meta->get_static_metadata();
+    size_t width = members.size();
+    for (size_t i = 0; i < members.size(); ++i) {
+        if (members[i].name == "width") {
+            width = i;
+        }
+    }
+    ASSERT_LT(width, members.size());
+
+    EXPECT_FALSE(meta->get_member(width, Resolve::Existing));
+    auto member = meta->get_member(width);
+    ASSERT_TRUE(member);
+    EXPECT_EQ(interface_cast<IProperty>(member), meta->get_property("width").get());
+    EXPECT_EQ(meta->get_member(width, Resolve::Existing), member);
+    EXPECT_FALSE(meta->get_member(members.size()));
+}
+
+TEST_F(ObjectTest, GetMemberByIndexAcrossAttachments)
+{
+    auto obj = instance().create<IObject>(TestWidget::class_id());
+    auto* storage = interface_cast<IObjectStorage>(obj);
+    ASSERT_NE(storage, nullptr);
+
+    // Instances created by name before and after the first index lookup, with attachments
+    // inserted ahead of them in between
+    auto width = storage->get_property("width");
+    ASSERT_TRUE(width);
+    auto members = storage->get_static_metadata();
+    vector<IInterface::Ptr> byIndex;
+    for (size_t i = 0; i < members.size(); ++i) {
+        byIndex.push_back(storage->get_member(i));
+        ASSERT_TRUE(byIndex.back());
+        EXPECT_TRUE(succeeded(storage->add_attachment(instance().create<IInterface>(ClassId::Hierarchy))));
+    }
+    EXPECT_TRUE(succeeded(storage->remove_attachment(storage->get_attachment(0))));
+    for (size_t i = 0; i < members.size(); ++i) {
+        EXPECT_EQ(storage->get_member(i, Resolve::Existing), byIndex[i]) << members[i].name;
+        if (members[i].name == "width" && members[i].kind == MemberKind::Property) {
+            EXPECT_EQ(interface_cast<IProperty>(byIndex[i]), width.get());
+        }
+    }
+}
+
 TEST_F(ObjectTest, ImmediateWriteStateCallback)
 {
     auto obj = instance().create<IObject>(TestWidget::class_id());
@@ -1189,3 +1238,50 @@ TEST_F(ObjectWrapperTest, NullObjectSafe)
     EXPECT_FALSE(obj.find_or_create_attachment<IHierarchy>(ClassId::Hierarchy));
     EXPECT_FALSE(obj.get());
 }
+
+// --- Interface dispatch over many interfaces ---
+
+namespace {
+
+template <int I>
+class IWideTest : public Interface<IWideTest<I>>
+{};
+
+class IWideDerived : public Interface<IWideDerived, IWideTest<0>>
+{};
+
+class WideObject : public ext::ObjectCore<WideObject, IWideDerived, IWideTest<1>, IWideTest<2>, IWideTest<3>,
+                                          IWideTest<4>, IWideTest<5>, IWideTest<6>, IWideTest<7>, IWideTest<8>,
+                                          IWideTest<9>, IWideTest<10>, IWideTest<11>>
+{};
+
+template <int I>
+bool resolves_wide(WideObject& obj)
+{
+    IInterface* base = static_cast<IObject*>(&obj);
+    return base->get_interface<IWideTest<I>>() == static_cast<IWideTest<I>*>(&obj);
+}
+
+template <int... Is>
+int count_resolved(WideObject& obj, std::integer_sequence<int, Is...>)
+{
+    return (0 + ... + int(resolves_wide<Is>(obj)));
+}
+
+} // namespace
+
+TEST(InterfaceDispatch, ResolvesEveryInterfaceOfWideClass)
+{
+    auto obj = ext::make_object<WideObject>();
+    auto* wide = static_cast<WideObject*>(interface_cast<IWideDerived>(obj));
+    ASSERT_NE(wide, nullptr);
+    EXPECT_EQ(count_resolved(*wide, std::make_integer_sequence<int, 12>{}), 12);
+
+    IInterface* base = static_cast<IObject*>(wide);
+    EXPECT_EQ(base->get_interface<IWideDerived>(), static_cast<IWideDerived*>(wide));
+    EXPECT_EQ(base->get_interface<IObject>(), static_cast<IObject*>(wide));
+    EXPECT_EQ(base->get_interface(IInterface::UID), base);
+    EXPECT_EQ(base->get_interface<IMetadata>(), nullptr);
+    EXPECT_EQ(base->get_interface<IWideTest<12>>(), nullptr);
+    EXPECT_EQ(WideObject::class_interfaces.size(), 14u); // IObject, IWideDerived and 12 IWideTest
+}
@@ -6,6 +6,8 @@
 #include <velk/memory.h>
 
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 using namespace velk;
 
@@ -499,3 +501,130 @@ TEST(WeakPtrPlain, MultipleWeakPtrs)
     EXPECT_TRUE(wp2.expired());
     EXPECT_EQ(PlainData::destroyed_count, 1);
 }
+
+// Thread-confined objects (non-atomic reference counting)
+
+TEST(SharedPtrThreadConfined, FlagSelectsLocalBlock)
+{
+    auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+    ASSERT_TRUE(obj);
+    ASSERT_NE(obj.block(), nullptr);
+    EXPECT_TRUE(obj.block()->is_local());
+    EXPECT_TRUE(obj->get_object_flags() & ObjectFlags::ThreadConfined);
+
+    auto plain = instance().create<IObject>(TrackableObject::class_id());
+    EXPECT_FALSE(plain.block()->is_local());
+    EXPECT_FALSE(plain->get_object_flags() & ObjectFlags::ThreadConfined);
+}
+
+TEST(SharedPtrThreadConfined, LocalTagDoesNotAffectSelfPointer)
+{
+    auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+    EXPECT_EQ(obj.block()->get_ptr(), static_cast<void*>(obj.get()));
+    auto self = obj->get_self();
+    EXPECT_EQ(self.get(), obj.get());
+}
+
+TEST(SharedPtrThreadConfined, CopiesKeepObjectAlive)
+{
+    TrackableObject::alive_count = 0;
+    {
+        auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+        auto copy1 = obj;
+        auto copy2 = copy1;
+        EXPECT_EQ(obj.block()->strong.load(), 3);
+        obj.reset();
+        copy1.reset();
+        EXPECT_EQ(TrackableObject::alive_count, 1);
+        copy2.reset();
+        EXPECT_EQ(TrackableObject::alive_count, 0);
+    }
+}
+
+TEST(SharedPtrThreadConfined, WeakPtrLockAndExpire)
+{
+    TrackableObject::alive_count = 0;
+    weak_ptr<IObject> wp;
+    {
+        auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+        wp = obj;
+        auto locked = wp.lock();
+        EXPECT_TRUE(locked);
+        EXPECT_EQ(locked.get(), obj.get());
+    }
+    EXPECT_EQ(TrackableObject::alive_count, 0);
+    EXPECT_TRUE(wp.expired());
+    EXPECT_FALSE(wp.lock());
+}
+
+TEST(SharedPtrThreadConfined, SharePromotesToAtomic)
+{
+    auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+    auto copy = obj;
+    share(obj);
+    EXPECT_FALSE(obj.block()->is_local());
+    EXPECT_FALSE(obj->get_object_flags() & ObjectFlags::ThreadConfined);
+    EXPECT_EQ(obj.block()->get_ptr(), static_cast<void*>(obj.get()));
+    EXPECT_EQ(obj.block()->strong.load(), 2);
+}
+
+TEST(SharedPtrThreadConfined, OwnerRecordIsPerThread)
+{
+    auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+    auto* block = obj.block();
+    detail::set_local_owner(block, detail::current_thread_tag()); // Debug builds already did this
+    EXPECT_TRUE(detail::is_local_owner(block));
+    bool otherIsOwner = true;
+    std::thread other([&] { otherIsOwner = detail::is_local_owner(block); });
+    other.join();
+    EXPECT_FALSE(otherIsOwner);
+    detail::set_local_owner(block, 0);
+    EXPECT_TRUE(detail::is_local_owner(block));
+}
+
+TEST(SharedPtrThreadConfinedDeathTest, WeakPtrCopiedOffThreadAsserts)
+{
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    auto obj = instance().create<IObject>(TrackableObject::class_id(), ObjectFlags::ThreadConfined);
+    weak_ptr<IObject> wp = obj;
+    // weak_ptr copies update the block directly, without going through ref()/unref()
+    EXPECT_DEBUG_DEATH(
+        {
+            std::thread other([&] { weak_ptr<IObject> copy = wp; });
+            other.join();
+        },
+        "off-thread");
+}
+
+// Control block pool: cross-thread balancing
+
+TEST(ControlBlockPool, CrossThreadReleaseRefillsAllocatingThread)
+{
+    constexpr int count = 2048;
+    std::vector<control_block*> blocks;
+    blocks.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        blocks.push_back(detail::alloc_control_block());
+    }
+    // Release everything on another thread; its pool overflows into the depot.
+    std::thread consumer([&] {
+        for (auto* b : blocks) {
+            detail::dealloc_control_block(b);
+        }
+    });
+    consumer.join();
+
+    auto before = detail::get_block_pool_stats();
+    if (before.allocs == 0) {
+        GTEST_SKIP() << "Control block pooling is disabled";
+    }
+    for (int i = 0; i < count; ++i) {
+        blocks[i] = detail::alloc_control_block();
+    }
+    auto after = detail::get_block_pool_stats();
+    EXPECT_GT(after.refills, before.refills);
+    EXPECT_GT(after.hits - before.hits, static_cast<uint64_t>(count / 2));
+    for (auto* b : blocks) {
+        detail::dealloc_control_block(b);
+    }
+}
@@ -0,0 +1,167 @@
+#include <velk/api/velk.h>
+#include <velk/small_vector.h>
+
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace velk;
+
+namespace {
+
+// Tracks construction/destruction to verify proper lifetime management.
+struct Counted
+{
+    static int alive;
+    int value;
+
+    explicit Counted(int v = 0) : value(v) { ++alive; }
+    Counted(const Counted& o) : value(o.value) { ++alive; }
+    Counted(Counted&& o) noexcept : value(o.value)
+    {
+        o.value = -1;
+        ++alive;
+    }
+    Counted& operator=(const Counted& o) = default;
+    Counted& operator=(Counted&& o) noexcept
+    {
+        value = o.value;
+        o.value = -1;
+        return *this;
+    }
+    ~Counted() { --alive; }
+    bool operator==(const Counted& o) const { return value == o.value; }
+};
+int Counted::alive = 0;
+
+uint64_t default_allocations()
+{
+    return instance().get_allocator_stats(AllocatorSlot::Default).allocations;
+}
+
+} // namespace
+
+TEST(SmallVector, DefaultConstructIsInline)
+{
+    small_vector<int, 4> v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 4u);
+}
+
+TEST(SmallVector, InlineGrowthDoesNotAllocate)
+{
+    auto before = default_allocations();
+    {
+        small_vector<int, 4> v;
+        for (int i = 0; i < 4; ++i) {
+            v.push_back(i);
+        }
+        EXPECT_TRUE(v.is_inline());
+        EXPECT_EQ(v.size(), 4u);
+    }
+    EXPECT_EQ(default_allocations(), before);
+}
+
+TEST(SmallVector, SpillsToHeap)
+{
+    small_vector<int, 2> v{1, 2};
+    EXPECT_TRUE(v.is_inline());
+    v.push_back(3);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_GE(v.capacity(), 3u);
+    EXPECT_EQ(v, (small_vector<int, 2>{1, 2, 3}));
+}
+
+TEST(SmallVector, PushBackSelfReferenceAcrossSpill)
+{
+    small_vector<std::string, 2> v;
+    v.push_back("first");
+    v.push_back("second");
+    v.push_back(v[0]);
+    ASSERT_EQ(v.size(), 3u);
+    EXPECT_EQ(v[2], "first");
+}
+
+TEST(SmallVector, InsertAndErase)
+{
+    small_vector<Counted, 2> v;
+    v.emplace_back(1);
+    v.emplace_back(3);
+    v.insert(v.begin() + 1, Counted(2));
+    v.insert(v.begin(), Counted(0));
+    ASSERT_EQ(v.size(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(v[i].value, i);
+    }
+    v.erase(v.begin() + 1);
+    EXPECT_EQ(v.size(), 3u);
+    EXPECT_EQ(v[1].value, 2);
+    v.erase(v.begin(), v.begin() + 2);
+    ASSERT_EQ(v.size(), 1u);
+    EXPECT_EQ(v[0].value, 3);
+    v.clear();
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(SmallVector, MoveInline)
+{
+    {
+        small_vector<Counted, 4> a;
+        a.emplace_back(7);
+        a.emplace_back(8);
+        small_vector<Counted, 4> b(std::move(a));
+        EXPECT_TRUE(a.empty());
+        EXPECT_TRUE(b.is_inline());
+        ASSERT_EQ(b.size(), 2u);
+        EXPECT_EQ(b[1].value, 8);
+        EXPECT_EQ(Counted::alive, 2);
+    }
+    EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(SmallVector, MoveHeapStealsBuffer)
+{
+    small_vector<int, 1> a{1, 2, 3};
+    const int* buf = a.data();
+    small_vector<int, 1> b;
+    b = std::move(a);
+    EXPECT_EQ(b.data(), buf);
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_TRUE(a.empty());
+    a.push_back(4);
+    EXPECT_EQ(a[0], 4);
+}
+
+TEST(SmallVector, CopyAndSwap)
+{
+    small_vector<std::string, 2> a{"a"};
+    small_vector<std::string, 2> b{"x", "y", "z"};
+    small_vector<std::string, 2> c(b);
+    EXPECT_EQ(b, c);
+    a.swap(b);
+    EXPECT_EQ(a.size(), 3u);
+    ASSERT_EQ(b.size(), 1u);
+    EXPECT_EQ(b[0], "a");
+}
+
+TEST(SmallVector, ShrinkToFitReturnsInline)
+{
+    small_vector<Counted, 2> v;
+    for (int i = 0; i < 5; ++i) {
+        v.emplace_back(i);
+    }
+    EXPECT_FALSE(v.is_inline());
+    v.resize(2);
+    v.shrink_to_fit();
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v[1].value, 1);
+    EXPECT_EQ(Counted::alive, 2);
+}
+
+TEST(SmallVector, ArrayViewConversion)
+{
+    small_vector<int, 4> v{4, 5, 6};
+    array_view<int> view = v;
+    EXPECT_EQ(view.size(), 3u);
+    EXPECT_EQ(view[2], 6);
+}
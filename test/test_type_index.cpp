@@ -0,0 +1,102 @@
+#include <velk/api/velk.h>
+#include <velk/ext/object.h>
+#include <velk/interface/intf_metadata.h>
+#include <velk/type_index.h>
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace velk;
+
+namespace {
+
+class ITypeIndexProbe : public Interface<ITypeIndexProbe>
+{};
+
+class TypeIndexWidget : public ext::Object<TypeIndexWidget, ITypeIndexProbe>
+{};
+
+} // namespace
+
+TEST(TypeIndex, NullUidIsZero)
+{
+    EXPECT_EQ(detail::type_index(Uid{}), 0u);
+    EXPECT_EQ(type_index<IInterface>(), 0u);
+    EXPECT_EQ(detail::type_index_uid(0), Uid{});
+}
+
+TEST(TypeIndex, AssignsStableDenseIndices)
+{
+    Uid a{"6b1e2a44-0c1d-4a8e-9d3b-6f1f0a2c7e11"};
+    Uid b{"6b1e2a44-0c1d-4a8e-9d3b-6f1f0a2c7e12"};
+    EXPECT_EQ(detail::find_type_index(a), invalid_type_index);
+
+    auto ia = detail::type_index(a);
+    auto ib = detail::type_index(b);
+    ASSERT_NE(ia, invalid_type_index);
+    ASSERT_NE(ib, invalid_type_index);
+    EXPECT_EQ(ib, ia + 1);
+    EXPECT_EQ(detail::type_index(a), ia);
+    EXPECT_EQ(detail::find_type_index(b), ib);
+    EXPECT_EQ(detail::type_index_uid(ia), a);
+    EXPECT_EQ(detail::type_index_uid(ib), b);
+    EXPECT_EQ(detail::type_index_uid(invalid_type_index), Uid{});
+}
+
+TEST(TypeIndex, TemplateUsesTypeUid)
+{
+    auto probe = type_index<ITypeIndexProbe>();
+    auto widget = type_index<TypeIndexWidget>();
+    auto value = type_index<float>();
+    EXPECT_EQ(probe, detail::find_type_index(ITypeIndexProbe::UID));
+    EXPECT_EQ(widget, detail::find_type_index(TypeIndexWidget::class_id()));
+    EXPECT_NE(widget, probe);
+    EXPECT_EQ(value, detail::find_type_index(type_uid<float>()));
+}
+
+TEST(TypeIndex, FactoryCachesIndex)
+{
+    auto& factory = TypeIndexWidget::get_factory();
+    EXPECT_EQ(factory.get_type_index(), type_index<TypeIndexWidget>());
+    EXPECT_EQ(detail::type_index_uid(factory.get_type_index()), TypeIndexWidget::class_id());
+}
+
+TEST(TypeIndex, RegistryLookupByUid)
+{
+    auto& registry = instance().type_registry();
+    EXPECT_EQ(registry.find_factory(TypeIndexWidget::class_id()), nullptr);
+
+    registry.register_type<TypeIndexWidget>();
+    EXPECT_EQ(registry.find_factory(TypeIndexWidget::class_id()), &TypeIndexWidget::get_factory());
+    EXPECT_TRUE(instance().create<ITypeIndexProbe>(TypeIndexWidget::class_id()));
+
+    registry.unregister_type<TypeIndexWidget>();
+    EXPECT_EQ(registry.find_factory(TypeIndexWidget::class_id()), nullptr);
+    EXPECT_FALSE(instance().create<IObject>(TypeIndexWidget::class_id()));
+}
+
+TEST(TypeIndex, ConcurrentAssignment)
+{
+    constexpr int kThreads = 4;
+    constexpr int kUids = 1000;
+    std::vector<std::vector<TypeIndex>> results(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < kUids; ++i) {
+                results[t].push_back(detail::type_index(Uid{0x7a5e000000000000ull, uint64_t(i)}));
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (int i = 0; i < kUids; ++i) {
+        ASSERT_NE(results[0][i], invalid_type_index);
+        for (int t = 1; t < kThreads; ++t) {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+        EXPECT_EQ(detail::type_index_uid(results[0][i]), (Uid{0x7a5e000000000000ull, uint64_t(i)}));
+    }
+}
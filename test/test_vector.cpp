@@ -1,3 +1,5 @@
+#include <velk/memory.h>
+#include <velk/string.h>
 #include <velk/vector.h>
 
 #include <gtest/gtest.h>
@@ -591,3 +593,59 @@ TEST(Vector, ManyPushBacks)
         EXPECT_EQ(v[i], i);
     }
 }
+
+// Trivially relocatable types (realloc/memmove paths)
+
+static_assert(is_trivially_relocatable_v<int>);
+static_assert(is_trivially_relocatable_v<velk::string>);
+static_assert(is_trivially_relocatable_v<shared_ptr<int>>);
+static_assert(is_trivially_relocatable_v<vector<Tracked>>);
+static_assert(is_trivially_relocatable_v<std::pair<size_t, shared_ptr<int>>>);
+static_assert(!is_trivially_relocatable_v<Tracked>);
+
+TEST(Vector, RelocatableGrowthKeepsValues)
+{
+    vector<velk::string> v;
+    for (int i = 0; i < 100; ++i) {
+        // Mix inline (short) and heap (long) strings
+        v.push_back(velk::string(i % 2 ? "short" : "a string that is too long for the inline buffer"));
+    }
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(v[i], i % 2 ? "short" : "a string that is too long for the inline buffer");
+    }
+}
+
+TEST(Vector, RelocatableInsertAndEraseKeepRefCounts)
+{
+    auto p = make_shared<int>(7);
+    {
+        vector<shared_ptr<int>> v;
+        v.push_back(p);
+        v.push_back(p);
+        v.insert(v.begin() + 1, p);
+        EXPECT_EQ(p.block()->strong.load(), 4);
+        const shared_ptr<int> more[] = {p, p};
+        v.insert(v.begin(), more, more + 2);
+        EXPECT_EQ(v.size(), 5u);
+        EXPECT_EQ(p.block()->strong.load(), 8);
+        v.erase(v.begin() + 2);
+        v.erase(v.begin(), v.begin() + 2);
+        EXPECT_EQ(v.size(), 2u);
+        EXPECT_EQ(p.block()->strong.load(), 5);
+        EXPECT_EQ(*v[1], 7);
+    }
+    EXPECT_EQ(p.block()->strong.load(), 1);
+}
+
+TEST(Vector, RelocatableInsertSelfRange)
+{
+    vector<velk::string> v{velk::string("a"), velk::string("b")};
+    v.insert(v.begin() + 1, v.begin(), v.end());
+    ASSERT_EQ(v.size(), 4u);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[1], "a");
+    EXPECT_EQ(v[2], "b");
+    EXPECT_EQ(v[3], "b");
+}
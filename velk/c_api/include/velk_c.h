@@ -39,6 +39,8 @@ typedef struct velk_object_s*    velk_object;
 typedef struct velk_property_s*  velk_property;
 typedef struct velk_event_s*     velk_event;
 typedef struct velk_function_s*  velk_function;
+typedef struct velk_hive_store_s* velk_hive_store;
+typedef struct velk_hive_s*       velk_hive;
 
 /* 128-bit UID, passed by value */
 typedef struct velk_uid
@@ -115,6 +117,101 @@ VELK_C_API velk_event velk_get_event(velk_object obj, const char* name);
  */
 VELK_C_API velk_function velk_get_function(velk_object obj, const char* name);
 
+/* Member ordinals */
+
+/** @brief Member kinds of velk_member_info and velk_resolve_member(). */
+#define VELK_MEMBER_PROPERTY       0
+#define VELK_MEMBER_EVENT          1
+#define VELK_MEMBER_FUNCTION       2
+#define VELK_MEMBER_ARRAY_PROPERTY 3
+
+/** @brief Returned by velk_resolve_member() when no member matches. */
+#define VELK_INVALID_ORDINAL ((int32_t)-1)
+
+/** @brief Describes a member of a class. */
+typedef struct velk_member_info
+{
+    const char* name;      /**< Member name, not null-terminated. */
+    size_t name_length;    /**< Length of name in bytes. */
+    int32_t kind;          /**< One of the VELK_MEMBER_* kinds. */
+    velk_uid type;         /**< Value type UID of properties, zero for events and functions. */
+    velk_uid interface_id; /**< UID of the interface that declares the member. */
+} velk_member_info;
+
+/**
+ * @brief Returns the number of members of the registered class @p class_id.
+ * Members are numbered by ordinals in [0, count). Returns 0 for unknown classes.
+ */
+VELK_C_API size_t velk_class_member_count(velk_uid class_id);
+
+/**
+ * @brief Describes the member at @p ordinal of class @p class_id.
+ * The name stays valid while the class is registered.
+ * @return VELK_INVALID_ARG if the class is unknown or @p ordinal is out of range.
+ */
+VELK_C_API velk_result velk_class_member(velk_uid class_id, int32_t ordinal, velk_member_info* out);
+
+/**
+ * @brief Returns the ordinal of the member @p name of kind @p kind in class @p class_id.
+ * VELK_MEMBER_PROPERTY also matches array properties, like velk_get_property().
+ * Ordinals are stable while the class is registered, so bindings resolve them once.
+ * @return The ordinal, or VELK_INVALID_ORDINAL if the class has no such member.
+ */
+VELK_C_API int32_t velk_resolve_member(velk_uid class_id, const char* name, int32_t kind);
+
+/**
+ * @brief Returns the property at @p ordinal of @p obj, without a name lookup.
+ * The ordinal must come from the class of @p obj. Returns NULL if it is out of range or not
+ * a property. The returned handle has one reference; caller must velk_release() it.
+ */
+VELK_C_API velk_property velk_get_property_by_ordinal(velk_object obj, int32_t ordinal);
+
+/** @brief Like velk_get_property_by_ordinal(), for events. */
+VELK_C_API velk_event velk_get_event_by_ordinal(velk_object obj, int32_t ordinal);
+
+/** @brief Like velk_get_property_by_ordinal(), for functions. */
+VELK_C_API velk_function velk_get_function_by_ordinal(velk_object obj, int32_t ordinal);
+
+/* State access */
+
+/** @brief Describes a field of an interface's State struct. */
+typedef struct velk_state_field
+{
+    const char* name;   /**< Property name, not null-terminated. */
+    size_t name_length; /**< Length of name in bytes. */
+    int32_t ordinal;    /**< Member ordinal of the property in the class. */
+    int32_t kind;       /**< VELK_MEMBER_PROPERTY or VELK_MEMBER_ARRAY_PROPERTY. */
+    velk_uid type;      /**< Type UID of the field. */
+    size_t offset;      /**< Byte offset of the field in the State struct. */
+    size_t size;        /**< Size of the field in bytes. */
+    int32_t read_only;  /**< Nonzero if the property is read-only. */
+} velk_state_field;
+
+/**
+ * @brief Returns the State struct of interface @p interface_id in @p obj, or NULL.
+ * The pointer stays valid for the lifetime of the object. Its layout is given by
+ * velk_describe_state(). Reads and writes through it bypass the property system: after
+ * writing, call velk_notify_state_changed(). Only fields of trivially copyable types
+ * (the VELK_TYPE_* types) may be written directly; read-only fields must not be written.
+ */
+VELK_C_API void* velk_get_state(velk_object obj, velk_uid interface_id);
+
+/**
+ * @brief Describes the State struct of interface @p interface_id as laid out in class @p class_id.
+ * Fields are listed in declaration order.
+ * @param fields    Receives up to @p capacity fields. May be NULL to query the count.
+ * @param capacity  Number of entries in @p fields.
+ * @return The number of fields of the State struct, 0 if the class or interface is unknown.
+ */
+VELK_C_API size_t velk_describe_state(velk_uid class_id, velk_uid interface_id, velk_state_field* fields,
+                                      size_t capacity);
+
+/**
+ * @brief Fires on_changed for the properties of interface @p interface_id in @p obj.
+ * Call after writing the State returned by velk_get_state().
+ */
+VELK_C_API velk_result velk_notify_state_changed(velk_object obj, velk_uid interface_id);
+
 /* Property get/set (type-erased) */
 
 /**
@@ -146,6 +243,65 @@ VELK_C_API velk_result velk_property_set_double(velk_property prop, double value
 VELK_C_API velk_result velk_property_get_bool(velk_property prop, int32_t* out);
 VELK_C_API velk_result velk_property_set_bool(velk_property prop, int32_t value);
 
+/* Property get/set (batched) */
+
+/**
+ * @brief Reads the values of @p count properties into a packed buffer.
+ * Value i is written at @p out + i * @p size. NULL handles and properties that fail
+ * (e.g. of another type) are skipped and their slots are left untouched.
+ * @param props  Array of @p count property handles.
+ * @param count  Number of properties.
+ * @param out    Destination buffer of @p count * @p size bytes.
+ * @param size   Size of one value in bytes.
+ * @param type   Type UID of the values.
+ * @return The number of values read.
+ */
+VELK_C_API size_t velk_property_get_many(const velk_property* props, size_t count, void* out, size_t size,
+                                         velk_uid type);
+
+/**
+ * @brief Writes the values of @p count properties from a packed buffer.
+ * Value i is read from @p data + i * @p size. Each property notifies on_changed as with
+ * velk_property_set(). NULL handles and properties that fail are skipped.
+ * @return The number of values written, including unchanged ones.
+ */
+VELK_C_API size_t velk_property_set_many(const velk_property* props, size_t count, const void* data,
+                                         size_t size, velk_uid type);
+
+/* Object-strided access */
+
+/** @brief Notification modes of velk_scatter(). */
+#define VELK_NOTIFY_IMMEDIATE 0 /**< Notify each object right after its value is written. */
+#define VELK_NOTIFY_BATCHED   1 /**< Write all values first, then notify each written object. */
+#define VELK_NOTIFY_NONE      2 /**< Do not notify. */
+
+/**
+ * @brief Reads the property @p name of @p count objects into a packed buffer.
+ * The property is resolved once per class and read from the objects' State without
+ * creating property handles. Supports the types of the VELK_TYPE_* constants; a bool
+ * value takes one byte. NULL objects and objects without the property are skipped and
+ * their slots are left untouched.
+ * @param objects  Array of @p count object handles.
+ * @param count    Number of objects.
+ * @param name     Property name.
+ * @param out      Destination buffer of @p count * @p size bytes.
+ * @param size     Size of one value in bytes; must match @p type.
+ * @param type     Type UID of the property.
+ * @return The number of values read.
+ */
+VELK_C_API size_t velk_gather(const velk_object* objects, size_t count, const char* name, void* out,
+                              size_t size, velk_uid type);
+
+/**
+ * @brief Writes the property @p name of @p count objects from a packed buffer.
+ * The counterpart of velk_gather(). Read-only properties are skipped. Writes the State
+ * directly, so values equal to the current ones still notify.
+ * @param notify  One of the VELK_NOTIFY_* modes.
+ * @return The number of values written.
+ */
+VELK_C_API size_t velk_scatter(const velk_object* objects, size_t count, const char* name, const void* data,
+                               size_t size, velk_uid type, int32_t notify);
+
 /**
  * @brief Returns the on_changed event for a property.
  * The returned handle has one reference; caller must velk_release() it.
@@ -168,7 +324,9 @@ typedef struct velk_args_s* velk_args;
 /**
  * @brief Creates an argument list with @p count slots.
  * Each slot must be filled with a velk_args_set_* call before invoking.
- * Caller must free with velk_args_destroy().
+ * Caller must free with velk_args_destroy(). The values are stored in the list itself,
+ * so setting them and invoking do not allocate. For one-off calls, velk_invoke_argv()
+ * avoids creating the list at all.
  */
 VELK_C_API velk_args velk_args_create(size_t count);
 
@@ -191,6 +349,138 @@ VELK_C_API void velk_args_set_bool(velk_args args, size_t index, int32_t value);
  */
 VELK_C_API velk_result velk_invoke_args(velk_function fn, velk_args args);
 
+/* Function arguments (inline) */
+
+/**
+ * @brief A scalar argument passed by value.
+ * @p type is one of the VELK_TYPE_* constants and selects the union member: f32 for
+ * VELK_TYPE_FLOAT, i32 for VELK_TYPE_INT32 and VELK_TYPE_BOOL (nonzero = true), f64 for
+ * VELK_TYPE_DOUBLE.
+ */
+typedef struct velk_arg
+{
+    velk_uid type;
+    union
+    {
+        float f32;
+        int32_t i32;
+        double f64;
+    } value;
+} velk_arg;
+
+/**
+ * @brief Invokes a function with an array of scalar arguments.
+ * The arguments are wrapped on the stack for the duration of the call, without allocating.
+ * @return VELK_INVALID_ARG if an argument has an unsupported type.
+ */
+VELK_C_API velk_result velk_invoke_argv(velk_function fn, const velk_arg* args, size_t count);
+
+/* Typed fast paths for common signatures; equivalent to velk_invoke_argv(). */
+
+VELK_C_API velk_result velk_invoke_f32(velk_function fn, float a);
+VELK_C_API velk_result velk_invoke_f32x2(velk_function fn, float a, float b);
+VELK_C_API velk_result velk_invoke_f32x3(velk_function fn, float a, float b, float c);
+VELK_C_API velk_result velk_invoke_i32(velk_function fn, int32_t a);
+VELK_C_API velk_result velk_invoke_i32x2(velk_function fn, int32_t a, int32_t b);
+VELK_C_API velk_result velk_invoke_f64(velk_function fn, double a);
+
+/* Hives */
+
+/**
+ * @brief Creates an empty hive store. Returns NULL on failure.
+ * The returned handle has one reference; the store owns its hives.
+ */
+VELK_C_API velk_hive_store velk_create_hive_store(void);
+
+/**
+ * @brief Returns the object hive for @p class_id, creating it if it does not exist.
+ * Returns NULL if the class is not registered. The returned handle has one reference.
+ */
+VELK_C_API velk_hive velk_get_hive(velk_hive_store store, velk_uid class_id);
+
+/** @brief Returns the object hive for @p class_id, or NULL if it does not exist. */
+VELK_C_API velk_hive velk_find_hive(velk_hive_store store, velk_uid class_id);
+
+/**
+ * @brief Returns the raw hive for @p id, creating it for elements of @p size bytes aligned to
+ * @p align if it does not exist. Raw hive slots are uninitialized memory owned by the caller.
+ */
+VELK_C_API velk_hive velk_get_raw_hive(velk_hive_store store, velk_uid id, size_t size, size_t align);
+
+/** @brief Returns the raw hive for @p id, or NULL if it does not exist. */
+VELK_C_API velk_hive velk_find_raw_hive(velk_hive_store store, velk_uid id);
+
+/** @brief Returns nonzero if @p hive is a raw hive. */
+VELK_C_API int32_t velk_hive_is_raw(velk_hive hive);
+
+/** @brief Returns the class UID (object hive) or element UID (raw hive) of @p hive. */
+VELK_C_API velk_uid velk_hive_element_uid(velk_hive hive);
+
+/** @brief Returns the number of live elements in @p hive. */
+VELK_C_API size_t velk_hive_size(velk_hive hive);
+
+/**
+ * @brief Creates an object in an object hive.
+ * Returns NULL on failure. The returned handle has one reference, in addition to the
+ * hive's own; the object stays in the hive after the handle is released.
+ */
+VELK_C_API velk_object velk_hive_add(velk_hive hive);
+
+/**
+ * @brief Creates @p count objects in an object hive.
+ * @param out  Receives a handle with one reference per created object. May be NULL, in which
+ *             case the objects are only held by the hive and are reached through its pages.
+ * @return The number of objects created.
+ */
+VELK_C_API size_t velk_hive_add_many(velk_hive hive, size_t count, velk_object* out);
+
+/**
+ * @brief Removes @p obj from an object hive. The object is destroyed once the last handle
+ * to it is released. Returns VELK_FAIL if the object is not in the hive.
+ */
+VELK_C_API velk_result velk_hive_remove(velk_hive hive, velk_object obj);
+
+/** @brief Allocates a slot in a raw hive. Returns uninitialized memory, or NULL. */
+VELK_C_API void* velk_hive_allocate(velk_hive hive);
+
+/** @brief Returns a slot obtained from velk_hive_allocate() to a raw hive. */
+VELK_C_API void velk_hive_deallocate(velk_hive hive, void* slot);
+
+/**
+ * @brief Returns the byte offset from an object's slot to the State struct of interface
+ * @p interface_id, or -1 if the objects do not have one. All objects of an object hive
+ * share this offset. The hive must hold at least one object.
+ */
+VELK_C_API ptrdiff_t velk_hive_state_offset(velk_hive hive, velk_uid interface_id);
+
+/**
+ * @brief Slot memory of one hive page.
+ * Slot i starts at slots + i * stride and is live if bit (i % 64) of active_bits[i / 64] is
+ * set. In an object hive a slot holds an object; add velk_hive_state_offset() to reach its
+ * State. The view stays valid until the hive is next modified.
+ */
+typedef struct velk_hive_page
+{
+    void* slots;                 /**< Address of the first slot. */
+    size_t stride;               /**< Distance between consecutive slots in bytes. */
+    size_t capacity;             /**< Number of slots in the page. */
+    size_t live;                 /**< Number of live slots. */
+    const uint64_t* active_bits; /**< Active-slot bitmask, (capacity + 63) / 64 words. */
+    size_t active_words;         /**< Number of words in active_bits. */
+} velk_hive_page;
+
+/** @brief Returns the number of pages of @p hive. */
+VELK_C_API size_t velk_hive_page_count(velk_hive hive);
+
+/** @brief Describes page @p index of @p hive. Returns VELK_INVALID_ARG if out of range. */
+VELK_C_API velk_result velk_hive_get_page(velk_hive hive, size_t index, velk_hive_page* out);
+
+/**
+ * @brief Describes up to @p capacity pages of @p hive, starting from page 0.
+ * @return The number of pages of the hive, which may exceed @p capacity.
+ */
+VELK_C_API size_t velk_hive_get_pages(velk_hive hive, velk_hive_page* pages, size_t capacity);
+
 /* Events/callbacks */
 
 /**
@@ -235,11 +525,15 @@ inline void velk_acquire(velk_object    h) { velk_acquire(reinterpret_cast<velk_
 inline void velk_acquire(velk_property  h) { velk_acquire(reinterpret_cast<velk_interface>(h)); }
 inline void velk_acquire(velk_event     h) { velk_acquire(reinterpret_cast<velk_interface>(h)); }
 inline void velk_acquire(velk_function  h) { velk_acquire(reinterpret_cast<velk_interface>(h)); }
+inline void velk_acquire(velk_hive_store h) { velk_acquire(reinterpret_cast<velk_interface>(h)); }
+inline void velk_acquire(velk_hive      h) { velk_acquire(reinterpret_cast<velk_interface>(h)); }
 
 inline void velk_release(velk_object    h) { velk_release(reinterpret_cast<velk_interface>(h)); }
 inline void velk_release(velk_property  h) { velk_release(reinterpret_cast<velk_interface>(h)); }
 inline void velk_release(velk_event     h) { velk_release(reinterpret_cast<velk_interface>(h)); }
 inline void velk_release(velk_function  h) { velk_release(reinterpret_cast<velk_interface>(h)); }
+inline void velk_release(velk_hive_store h) { velk_release(reinterpret_cast<velk_interface>(h)); }
+inline void velk_release(velk_hive      h) { velk_release(reinterpret_cast<velk_interface>(h)); }
 
 inline velk_interface velk_cast(velk_object h, velk_uid id)
 {
@@ -1,8 +1,12 @@
 #include <velk_c.h>
 
+#include <velk/api/bulk.h>
+#include <velk/api/hive/object_hive.h>
 #include <velk/api/velk.h>
 #include <velk/common.h>
+#include <velk/inline_any.h>
 #include <velk/ext/any.h>
+#include <velk/interface/hive/intf_hive_store.h>
 #include <velk/interface/intf_any.h>
 #include <velk/interface/intf_event.h>
 #include <velk/interface/intf_function.h>
@@ -11,6 +15,7 @@
 #include <velk/interface/intf_property.h>
 #include <velk/interface/intf_velk.h>
 #include <velk/interface/types.h>
+#include <velk/small_vector.h>
 #include <velk/uid.h>
 
 #include <cstring>
@@ -168,6 +173,149 @@ velk_function velk_get_function(velk_object obj, const char* name)
     return to_handle<velk_function>(fn);
 }
 
+// Member ordinals
+
+static_assert(VELK_MEMBER_PROPERTY == int32_t(MemberKind::Property) &&
+                  VELK_MEMBER_EVENT == int32_t(MemberKind::Event) &&
+                  VELK_MEMBER_FUNCTION == int32_t(MemberKind::Function) &&
+                  VELK_MEMBER_ARRAY_PROPERTY == int32_t(MemberKind::ArrayProperty),
+              "C member kinds must match MemberKind");
+
+static array_view<MemberDesc> class_members(velk_uid class_id)
+{
+    auto* info = ::velk::instance().type_registry().get_class_info(to_uid(class_id));
+    return info ? info->members : array_view<MemberDesc>{};
+}
+
+size_t velk_class_member_count(velk_uid class_id)
+{
+    return class_members(class_id).size();
+}
+
+velk_result velk_class_member(velk_uid class_id, int32_t ordinal, velk_member_info* out)
+{
+    auto members = class_members(class_id);
+    if (!out || ordinal < 0 || static_cast<size_t>(ordinal) >= members.size()) {
+        return VELK_INVALID_ARG;
+    }
+    auto& m = members[static_cast<size_t>(ordinal)];
+    auto* pk = m.propertyKind();
+    out->name = m.name.data();
+    out->name_length = m.name.size();
+    out->kind = static_cast<int32_t>(m.kind);
+    out->type = pk ? from_uid(pk->typeUid) : velk_uid{0, 0};
+    out->interface_id = m.interfaceInfo ? from_uid(m.interfaceInfo->uid) : velk_uid{0, 0};
+    return VELK_SUCCESS;
+}
+
+int32_t velk_resolve_member(velk_uid class_id, const char* name, int32_t kind)
+{
+    if (!name) {
+        return VELK_INVALID_ORDINAL;
+    }
+    string_view n(name, strlen(name));
+    auto hash = hash_string(n);
+    auto members = class_members(class_id);
+    for (size_t i = 0; i < members.size(); ++i) {
+        auto& m = members[i];
+        auto k = static_cast<int32_t>(m.kind);
+        bool kindMatches = k == kind || (kind == VELK_MEMBER_PROPERTY && k == VELK_MEMBER_ARRAY_PROPERTY);
+        if (kindMatches && m.nameHash == hash && m.name == n) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return VELK_INVALID_ORDINAL;
+}
+
+// Returns the member at ordinal if its kind is one of kinds (a bitmask of 1 << MemberKind)
+static IInterface::Ptr member_by_ordinal(velk_object obj, int32_t ordinal, uint32_t kinds)
+{
+    if (!obj || ordinal < 0) {
+        return {};
+    }
+    auto* meta = interface_cast<IMetadata>(from_handle(reinterpret_cast<velk_interface>(obj)));
+    if (!meta) {
+        return {};
+    }
+    auto members = meta->get_static_metadata();
+    auto index = static_cast<size_t>(ordinal);
+    if (index >= members.size() || !(kinds & (1u << static_cast<uint32_t>(members[index].kind)))) {
+        return {};
+    }
+    return meta->get_member(index);
+}
+
+velk_property velk_get_property_by_ordinal(velk_object obj, int32_t ordinal)
+{
+    constexpr uint32_t kinds = (1u << VELK_MEMBER_PROPERTY) | (1u << VELK_MEMBER_ARRAY_PROPERTY);
+    auto member = member_by_ordinal(obj, ordinal, kinds);
+    return to_handle<velk_property>(interface_cast<IProperty>(member));
+}
+
+velk_event velk_get_event_by_ordinal(velk_object obj, int32_t ordinal)
+{
+    auto member = member_by_ordinal(obj, ordinal, 1u << VELK_MEMBER_EVENT);
+    return to_handle<velk_event>(interface_cast<IEvent>(member));
+}
+
+velk_function velk_get_function_by_ordinal(velk_object obj, int32_t ordinal)
+{
+    auto member = member_by_ordinal(obj, ordinal, 1u << VELK_MEMBER_FUNCTION);
+    return to_handle<velk_function>(interface_cast<IFunction>(member));
+}
+
+// State access
+
+void* velk_get_state(velk_object obj, velk_uid interface_id)
+{
+    if (!obj) {
+        return nullptr;
+    }
+    auto* ps = interface_cast<IPropertyState>(from_handle(reinterpret_cast<velk_interface>(obj)));
+    return ps ? ps->get_property_state(to_uid(interface_id)) : nullptr;
+}
+
+size_t velk_describe_state(velk_uid class_id, velk_uid interface_id, velk_state_field* fields, size_t capacity)
+{
+    Uid intf = to_uid(interface_id);
+    auto members = class_members(class_id);
+    size_t count = 0;
+    for (size_t i = 0; i < members.size(); ++i) {
+        auto& m = members[i];
+        auto* pk = m.propertyKind();
+        if (!pk || !pk->getOffset || !m.interfaceInfo || m.interfaceInfo->uid != intf) {
+            continue;
+        }
+        if (fields && count < capacity) {
+            auto* def = pk->getDefault ? pk->getDefault() : nullptr;
+            auto& f = fields[count];
+            f.name = m.name.data();
+            f.name_length = m.name.size();
+            f.ordinal = static_cast<int32_t>(i);
+            f.kind = static_cast<int32_t>(m.kind);
+            f.type = from_uid(pk->typeUid);
+            f.offset = pk->getOffset();
+            f.size = def ? def->get_data_size(pk->typeUid) : 0;
+            f.read_only = (pk->flags & ObjectFlags::ReadOnly) ? 1 : 0;
+        }
+        ++count;
+    }
+    return count;
+}
+
+velk_result velk_notify_state_changed(velk_object obj, velk_uid interface_id)
+{
+    if (!obj) {
+        return VELK_INVALID_ARG;
+    }
+    auto* meta = interface_cast<IMetadata>(from_handle(reinterpret_cast<velk_interface>(obj)));
+    if (!meta) {
+        return VELK_FAIL;
+    }
+    meta->notify(MemberKind::Property, to_uid(interface_id), Notification::Changed);
+    return VELK_SUCCESS;
+}
+
 // Property get/set (type-erased)
 
 velk_result velk_property_get(velk_property prop, void* out, size_t size, velk_uid type)
@@ -254,6 +402,168 @@ velk_result velk_property_set_bool(velk_property prop, int32_t value)
     return velk_property_set(prop, &tmp, sizeof(bool), t);
 }
 
+// Property get/set (batched)
+
+size_t velk_property_get_many(const velk_property* props, size_t count, void* out, size_t size, velk_uid type)
+{
+    if (!props || !out) {
+        return 0;
+    }
+    Uid t = to_uid(type);
+    auto* dst = static_cast<char*>(out);
+    size_t done = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!props[i]) {
+            continue;
+        }
+        auto* p = static_cast<IProperty*>(from_handle(reinterpret_cast<velk_interface>(props[i])));
+        auto val = p->get_value();
+        if (val && succeeded(val->get_data(dst + i * size, size, t))) {
+            ++done;
+        }
+    }
+    return done;
+}
+
+size_t velk_property_set_many(const velk_property* props, size_t count, const void* data, size_t size,
+                              velk_uid type)
+{
+    if (!props || !data) {
+        return 0;
+    }
+    Uid t = to_uid(type);
+    auto* src = static_cast<const char*>(data);
+    size_t done = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!props[i]) {
+            continue;
+        }
+        auto* pi = interface_cast<IPropertyInternal>(from_handle(reinterpret_cast<velk_interface>(props[i])));
+        if (pi && succeeded(pi->set_data(src + i * size, size, t))) {
+            ++done;
+        }
+    }
+    return done;
+}
+
+// Object-strided access
+//
+// Reads and writes the State members directly, like gather() and scatter() in api/bulk.h.
+// Only trivially copyable types are accepted, since the values are moved with memcpy.
+
+static size_t state_value_size(Uid type)
+{
+    if (type == type_uid<float>()) {
+        return sizeof(float);
+    }
+    if (type == type_uid<int>()) {
+        return sizeof(int);
+    }
+    if (type == type_uid<double>()) {
+        return sizeof(double);
+    }
+    if (type == type_uid<bool>()) {
+        return sizeof(bool);
+    }
+    return 0;
+}
+
+static IObject* bulk_object(velk_object obj)
+{
+    return obj ? static_cast<IObject*>(from_handle(reinterpret_cast<velk_interface>(obj))) : nullptr;
+}
+
+static auto state_resolver(string_view name, Uid type, bool writable)
+{
+    return [name, hash = hash_string(name), type, writable](IObject& object, Uid& interfaceUid) {
+        return detail::resolve_state_member(object, name, hash, type, writable, interfaceUid);
+    };
+}
+
+// Templated on the value size so the copies compile to plain loads and stores
+template <size_t Size, class Resolve>
+static size_t gather_values(const velk_object* objects, size_t count, Resolve& resolve, char* out)
+{
+    detail::BulkMemberCache cache;
+    size_t done = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto* object = bulk_object(objects[i]);
+        if (!object) {
+            continue;
+        }
+        if (auto* member = cache.find(*object, resolve)) {
+            std::memcpy(out + i * Size, member, Size);
+            ++done;
+        }
+    }
+    return done;
+}
+
+template <size_t Size, class Resolve>
+static size_t scatter_values(const velk_object* objects, size_t count, Resolve& resolve, const char* data,
+                             int32_t notify)
+{
+    detail::BulkMemberCache cache;
+    size_t done = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto* object = bulk_object(objects[i]);
+        if (!object) {
+            continue;
+        }
+        if (auto* member = cache.find(*object, resolve)) {
+            std::memcpy(member, data + i * Size, Size);
+            ++done;
+            if (notify == VELK_NOTIFY_IMMEDIATE) {
+                detail::notify_state_changed(*object, cache.interface_uid());
+            }
+        }
+    }
+    if (notify == VELK_NOTIFY_BATCHED && done) {
+        for (size_t i = 0; i < count; ++i) {
+            auto* object = bulk_object(objects[i]);
+            if (object && cache.find(*object, resolve)) {
+                detail::notify_state_changed(*object, cache.interface_uid());
+            }
+        }
+    }
+    return done;
+}
+
+size_t velk_gather(const velk_object* objects, size_t count, const char* name, void* out, size_t size,
+                   velk_uid type)
+{
+    Uid t = to_uid(type);
+    if (!objects || !name || !out || size == 0 || size != state_value_size(t)) {
+        return 0;
+    }
+    auto resolve = state_resolver(string_view(name, strlen(name)), t, false);
+    auto* dst = static_cast<char*>(out);
+    switch (size) {
+    case 1: return gather_values<1>(objects, count, resolve, dst);
+    case 4: return gather_values<4>(objects, count, resolve, dst);
+    case 8: return gather_values<8>(objects, count, resolve, dst);
+    default: return 0;
+    }
+}
+
+size_t velk_scatter(const velk_object* objects, size_t count, const char* name, const void* data, size_t size,
+                    velk_uid type, int32_t notify)
+{
+    Uid t = to_uid(type);
+    if (!objects || !name || !data || size == 0 || size != state_value_size(t) || notify < VELK_NOTIFY_IMMEDIATE ||
+        notify > VELK_NOTIFY_NONE) {
+        return 0;
+    }
+    auto resolve = state_resolver(string_view(name, strlen(name)), t, true);
+    auto* src = static_cast<const char*>(data);
+    switch (size) {
+    case 1: return scatter_values<1>(objects, count, resolve, src, notify);
+    case 4: return scatter_values<4>(objects, count, resolve, src, notify);
+    case 8: return scatter_values<8>(objects, count, resolve, src, notify);
+    default: return 0;
+    }
+}
+
 // Property on_changed
 
 velk_event velk_property_on_changed(velk_property prop)
@@ -279,24 +589,60 @@ velk_result velk_invoke(velk_function fn)
 }
 
 // Function arguments
+//
+// Argument values are scalars stored in InlineAny slots, so filling them in needs no factory
+// lookup and no allocation. The factories only serve functions that clone() an argument.
+
+using ArgAny = InlineAny<sizeof(double)>;
+
+template <class T>
+static void assign_arg(ArgAny& slot, T value)
+{
+    slot.assign_data(&value, sizeof(T), type_uid<T>(), &ext::AnyValue<T>::get_factory());
+}
+
+static bool assign_arg(ArgAny& slot, const velk_arg& arg)
+{
+    Uid t = to_uid(arg.type);
+    if (t == type_uid<float>()) {
+        assign_arg(slot, arg.value.f32);
+    } else if (t == type_uid<int>()) {
+        assign_arg<int>(slot, arg.value.i32);
+    } else if (t == type_uid<double>()) {
+        assign_arg(slot, arg.value.f64);
+    } else if (t == type_uid<bool>()) {
+        assign_arg<bool>(slot, arg.value.i32 != 0);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Invokes fn with up to 8 arguments
+static velk_result invoke_with(velk_function fn, const ArgAny* values, size_t count)
+{
+    const IAny* raw[8];
+    auto* f = static_cast<IFunction*>(from_handle(reinterpret_cast<velk_interface>(fn)));
+    for (size_t i = 0; i < count; ++i) {
+        raw[i] = &values[i];
+    }
+    f->invoke(FnArgs{raw, count});
+    return VELK_SUCCESS;
+}
 
 struct velk_args_s
 {
-    size_t count;
-    IAny::Ptr* owned;       // array of owned IAny pointers
-    const IAny** raw;       // array of raw pointers for FnArgs
+    small_vector<ArgAny, 4> values;
+    small_vector<const IAny*, 4> raw;
 
-    velk_args_s(size_t n) : count(n), owned(new IAny::Ptr[n]), raw(new const IAny*[n])
+    explicit velk_args_s(size_t n)
     {
+        values.resize(n);
+        raw.resize(n);
         for (size_t i = 0; i < n; ++i) {
-            raw[i] = nullptr;
+            raw[i] = &values[i];
         }
     }
-    ~velk_args_s()
-    {
-        delete[] owned;
-        delete[] raw;
-    }
 };
 
 velk_args velk_args_create(size_t count)
@@ -315,15 +661,10 @@ void velk_args_destroy(velk_args args)
 template <class T>
 static void args_set(velk_args args, size_t index, T value)
 {
-    if (!args || index >= args->count) {
+    if (!args || index >= args->values.size()) {
         return;
     }
-    auto any = ::velk::instance().create_any(type_uid<T>());
-    if (any) {
-        any->set_data(&value, sizeof(T), type_uid<T>());
-    }
-    args->owned[index] = any;
-    args->raw[index] = args->owned[index].get();
+    assign_arg(args->values[index], value);
 }
 
 void velk_args_set_float(velk_args args, size_t index, float value)
@@ -352,11 +693,259 @@ velk_result velk_invoke_args(velk_function fn, velk_args args)
         return VELK_INVALID_ARG;
     }
     auto* f = static_cast<IFunction*>(from_handle(reinterpret_cast<velk_interface>(fn)));
-    FnArgs fnargs{args->raw, args->count};
+    FnArgs fnargs{args->raw.data(), args->raw.size()};
     f->invoke(fnargs);
     return VELK_SUCCESS;
 }
 
+// Function arguments (inline)
+
+velk_result velk_invoke_argv(velk_function fn, const velk_arg* args, size_t count)
+{
+    if (!fn || (count && !args)) {
+        return VELK_INVALID_ARG;
+    }
+    if (count > 8) {
+        // Rare: build a heap list rather than growing the stack frame of every call
+        velk_args_s list(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!assign_arg(list.values[i], args[i])) {
+                return VELK_INVALID_ARG;
+            }
+        }
+        return velk_invoke_args(fn, &list);
+    }
+    ArgAny values[8];
+    for (size_t i = 0; i < count; ++i) {
+        if (!assign_arg(values[i], args[i])) {
+            return VELK_INVALID_ARG;
+        }
+    }
+    return invoke_with(fn, values, count);
+}
+
+template <class T, class... Ts>
+static velk_result invoke_typed(velk_function fn, Ts... values)
+{
+    if (!fn) {
+        return VELK_INVALID_ARG;
+    }
+    ArgAny slots[sizeof...(Ts)];
+    size_t i = 0;
+    (assign_arg<T>(slots[i++], values), ...);
+    return invoke_with(fn, slots, sizeof...(Ts));
+}
+
+velk_result velk_invoke_f32(velk_function fn, float a)
+{
+    return invoke_typed<float>(fn, a);
+}
+
+velk_result velk_invoke_f32x2(velk_function fn, float a, float b)
+{
+    return invoke_typed<float>(fn, a, b);
+}
+
+velk_result velk_invoke_f32x3(velk_function fn, float a, float b, float c)
+{
+    return invoke_typed<float>(fn, a, b, c);
+}
+
+velk_result velk_invoke_i32(velk_function fn, int32_t a)
+{
+    return invoke_typed<int>(fn, a);
+}
+
+velk_result velk_invoke_i32x2(velk_function fn, int32_t a, int32_t b)
+{
+    return invoke_typed<int>(fn, a, b);
+}
+
+velk_result velk_invoke_f64(velk_function fn, double a)
+{
+    return invoke_typed<double>(fn, a);
+}
+
+// Hives
+
+static IHiveStore* hive_store(velk_hive_store store)
+{
+    return store ? static_cast<IHiveStore*>(from_handle(reinterpret_cast<velk_interface>(store))) : nullptr;
+}
+
+static IHive* hive_of(velk_hive hive)
+{
+    return hive ? static_cast<IHive*>(from_handle(reinterpret_cast<velk_interface>(hive))) : nullptr;
+}
+
+static IObjectHive* object_hive(velk_hive hive)
+{
+    auto* h = hive_of(hive);
+    return h && h->get_hive_type() == HiveType::ObjectHive ? static_cast<IObjectHive*>(h) : nullptr;
+}
+
+static IRawHive* raw_hive(velk_hive hive)
+{
+    auto* h = hive_of(hive);
+    return h && h->get_hive_type() == HiveType::RawHive ? static_cast<IRawHive*>(h) : nullptr;
+}
+
+template <class T>
+static velk_hive to_hive_handle(const shared_ptr<T>& ptr)
+{
+    return to_handle<velk_hive>(static_cast<IInterface*>(static_cast<IHive*>(ptr.get())));
+}
+
+velk_hive_store velk_create_hive_store(void)
+{
+    auto ptr = ::velk::instance().create(ClassId::HiveStore);
+    auto* store = interface_cast<IHiveStore>(ptr);
+    return to_handle<velk_hive_store>(static_cast<IInterface*>(store));
+}
+
+velk_hive velk_get_hive(velk_hive_store store, velk_uid class_id)
+{
+    auto* s = hive_store(store);
+    return s ? to_hive_handle(s->get_hive(to_uid(class_id))) : nullptr;
+}
+
+velk_hive velk_find_hive(velk_hive_store store, velk_uid class_id)
+{
+    auto* s = hive_store(store);
+    return s ? to_hive_handle(s->find_hive(to_uid(class_id))) : nullptr;
+}
+
+velk_hive velk_get_raw_hive(velk_hive_store store, velk_uid id, size_t size, size_t align)
+{
+    auto* s = hive_store(store);
+    if (!s || !size || !align || (align & (align - 1))) {
+        return nullptr;
+    }
+    return to_hive_handle(s->get_raw_hive(to_uid(id), size, align));
+}
+
+velk_hive velk_find_raw_hive(velk_hive_store store, velk_uid id)
+{
+    auto* s = hive_store(store);
+    return s ? to_hive_handle(s->find_raw_hive(to_uid(id))) : nullptr;
+}
+
+int32_t velk_hive_is_raw(velk_hive hive)
+{
+    return raw_hive(hive) ? 1 : 0;
+}
+
+velk_uid velk_hive_element_uid(velk_hive hive)
+{
+    auto* h = hive_of(hive);
+    return h ? from_uid(h->get_element_uid()) : velk_uid{0, 0};
+}
+
+size_t velk_hive_size(velk_hive hive)
+{
+    auto* h = hive_of(hive);
+    return h ? h->size() : 0;
+}
+
+velk_object velk_hive_add(velk_hive hive)
+{
+    auto* h = object_hive(hive);
+    return h ? to_handle<velk_object>(h->add()) : nullptr;
+}
+
+size_t velk_hive_add_many(velk_hive hive, size_t count, velk_object* out)
+{
+    auto* h = object_hive(hive);
+    if (!h) {
+        return 0;
+    }
+    size_t added = 0;
+    for (; added < count; ++added) {
+        auto obj = h->add();
+        if (!obj) {
+            break;
+        }
+        if (out) {
+            out[added] = to_handle<velk_object>(obj);
+        }
+    }
+    return added;
+}
+
+velk_result velk_hive_remove(velk_hive hive, velk_object obj)
+{
+    auto* h = object_hive(hive);
+    if (!h || !obj) {
+        return VELK_INVALID_ARG;
+    }
+    auto* o = static_cast<IObject*>(from_handle(reinterpret_cast<velk_interface>(obj)));
+    return static_cast<velk_result>(h->remove(*o));
+}
+
+void* velk_hive_allocate(velk_hive hive)
+{
+    auto* h = raw_hive(hive);
+    return h ? h->allocate() : nullptr;
+}
+
+void velk_hive_deallocate(velk_hive hive, void* slot)
+{
+    auto* h = raw_hive(hive);
+    if (h && slot) {
+        h->deallocate(slot);
+    }
+}
+
+ptrdiff_t velk_hive_state_offset(velk_hive hive, velk_uid interface_id)
+{
+    auto* h = object_hive(hive);
+    return h ? detail::compute_state_offset(*h, to_uid(interface_id)) : -1;
+}
+
+static void to_page(const HivePageView& view, velk_hive_page& out)
+{
+    out.slots = view.slots;
+    out.stride = view.stride;
+    out.capacity = view.capacity;
+    out.live = view.live;
+    out.active_bits = view.active_bits;
+    out.active_words = (view.capacity + 63) / 64;
+}
+
+size_t velk_hive_page_count(velk_hive hive)
+{
+    auto* h = hive_of(hive);
+    return h ? h->get_page_count() : 0;
+}
+
+velk_result velk_hive_get_page(velk_hive hive, size_t index, velk_hive_page* out)
+{
+    auto* h = hive_of(hive);
+    HivePageView view;
+    if (!h || !out || !h->get_page(index, view)) {
+        return VELK_INVALID_ARG;
+    }
+    to_page(view, *out);
+    return VELK_SUCCESS;
+}
+
+size_t velk_hive_get_pages(velk_hive hive, velk_hive_page* pages, size_t capacity)
+{
+    auto* h = hive_of(hive);
+    if (!h) {
+        return 0;
+    }
+    size_t count = h->get_page_count();
+    HivePageView view;
+    for (size_t i = 0; i < count && i < capacity && pages; ++i) {
+        if (!h->get_page(i, view)) {
+            return i;
+        }
+        to_page(view, pages[i]);
+    }
+    return count;
+}
+
 // Callbacks
 
 struct CallbackContext
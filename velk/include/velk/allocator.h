@@ -0,0 +1,152 @@
+#ifndef VELK_ALLOCATOR_H
+#define VELK_ALLOCATOR_H
+
+#include <velk/velk_export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Tells the compiler that detail::allocate() returns fresh, unaliased storage of the requested
+// size, so buffers behave like malloc() results for alias analysis and object-size diagnostics.
+#if defined(__GNUC__)
+#define VELK_ALLOCATOR_FN __attribute__((malloc, alloc_size(1), alloc_align(2)))
+#else
+#define VELK_ALLOCATOR_FN
+#endif
+
+namespace velk {
+
+/**
+ * @brief Identifies a group of library allocations that can be routed to its own allocator.
+ *
+ * Slots without an installed allocator fall back to the Default slot's allocator,
+ * and the Default slot falls back to the system heap (malloc/free).
+ */
+enum class AllocatorSlot : uint8_t
+{
+    Default = 0,  ///< Control blocks, velk::vector/velk::string buffers and internal registries.
+    Hive = 1,     ///< Pages of user-created ObjectHive/RawHive instances.
+    Metadata = 2, ///< ObjectStorage pages and per-object metadata containers.
+    Deferred = 3, ///< Deferred task and deferred property queues.
+};
+
+/** @brief Number of AllocatorSlot values. */
+inline constexpr size_t allocator_slot_count = 4;
+
+/** @brief Allocation counters of one AllocatorSlot (see IVelk::get_allocator_stats()). */
+struct AllocatorStats
+{
+    uint64_t allocations;     ///< Number of allocate() calls.
+    uint64_t deallocations;   ///< Number of deallocate() calls.
+    uint64_t bytes_allocated; ///< Total bytes requested through allocate().
+    uint64_t bytes_freed;     ///< Total bytes returned through deallocate().
+
+    /** @brief Returns the number of bytes currently allocated through the slot. */
+    constexpr uint64_t live_bytes() const { return bytes_allocated - bytes_freed; }
+};
+
+/**
+ * @brief User-provided memory allocator (e.g. an arena, a linear frame allocator or a tracking allocator).
+ *
+ * Install with IVelk::set_allocator(). IAllocator is a plain abstract class rather than
+ * an IInterface because it sits below the object model: control blocks, velk::vector and
+ * velk::string allocate through it. The caller owns the allocator and must keep it alive
+ * for as long as memory allocated through it is outstanding.
+ *
+ * Implementations must be thread-safe; library allocations may happen on any thread.
+ */
+class IAllocator
+{
+public:
+    /**
+     * @brief Allocates @p size bytes aligned to @p alignment (a power of two).
+     * @return The allocation, or nullptr on failure.
+     */
+    virtual void* allocate(size_t size, size_t alignment) = 0;
+    /** @brief Frees memory returned by allocate(). @p size and @p alignment match the allocate() call. */
+    virtual void deallocate(void* ptr, size_t size, size_t alignment) = 0;
+    /**
+     * @brief Resizes an allocation from @p old_size to @p new_size bytes, preserving its contents.
+     *
+     * @p ptr may be nullptr (with @p old_size 0). The default implementation allocates,
+     * copies and deallocates; override it when the allocator can grow blocks in place.
+     * @return The resized allocation, or nullptr on failure (@p ptr is then left untouched).
+     */
+    virtual void* reallocate(void* ptr, size_t old_size, size_t new_size, size_t alignment)
+    {
+        void* p = allocate(new_size, alignment);
+        if (p && ptr) {
+            std::memcpy(p, ptr, old_size < new_size ? old_size : new_size);
+            deallocate(ptr, old_size, alignment);
+        }
+        return p;
+    }
+
+protected:
+    IAllocator() = default;
+    ~IAllocator() = default;
+};
+
+namespace detail {
+
+/** @brief Default alignment for allocations that don't specify one. */
+inline constexpr size_t default_alignment = alignof(std::max_align_t);
+
+/**
+ * @brief Allocates memory through the allocator installed for @p slot.
+ *
+ * Implemented in velk.cpp so that all modules share the same allocator table.
+ * Never returns nullptr for a non-zero @p size unless the installed allocator does.
+ */
+VELK_EXPORT VELK_ALLOCATOR_FN void* allocate(size_t size, size_t alignment = default_alignment,
+                                             AllocatorSlot slot = AllocatorSlot::Default);
+
+/**
+ * @brief Frees memory returned by allocate(). Arguments must match the allocate() call.
+ *
+ * Null @p ptr is a no-op.
+ */
+VELK_EXPORT void deallocate(void* ptr, size_t size, size_t alignment = default_alignment,
+                            AllocatorSlot slot = AllocatorSlot::Default);
+
+/**
+ * @brief Resizes memory returned by allocate() to @p new_size bytes, preserving its contents.
+ *
+ * @p ptr may be nullptr (with @p old_size 0). With no allocator installed this maps to
+ * realloc(), which can extend the block in place or remap it without copying.
+ * @p old_size, @p alignment and @p slot must match the original allocate() call.
+ */
+VELK_EXPORT void* reallocate(void* ptr, size_t old_size, size_t new_size, size_t alignment = default_alignment,
+                             AllocatorSlot slot = AllocatorSlot::Default);
+
+/**
+ * @brief Installs @p allocator for @p slot (nullptr restores the fallback).
+ *
+ * Fails if memory previously allocated through the slot's current allocator is
+ * still outstanding, since it would be freed through the wrong allocator. For
+ * the Default slot this includes every slot that falls back to it.
+ *
+ * Safe to call while other threads allocate: allocations wait for the install to be
+ * decided, and one that is in flight makes the install fail.
+ *
+ * @return true on success.
+ */
+VELK_EXPORT bool install_allocator(AllocatorSlot slot, IAllocator* allocator);
+
+/** @brief Returns the allocator installed for @p slot, or nullptr if the slot uses its fallback. */
+VELK_EXPORT IAllocator* get_allocator(AllocatorSlot slot);
+
+/**
+ * @brief Returns the allocation counters of @p slot.
+ *
+ * Counters are kept per thread group and summed here, so while other threads allocate
+ * the result is a snapshot that may already be stale.
+ */
+VELK_EXPORT AllocatorStats get_allocator_stats(AllocatorSlot slot);
+
+} // namespace detail
+
+} // namespace velk
+
+#endif // VELK_ALLOCATOR_H
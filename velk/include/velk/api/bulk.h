@@ -0,0 +1,278 @@
+#ifndef VELK_API_BULK_H
+#define VELK_API_BULK_H
+
+#include <velk/interface/intf_metadata.h>
+#include <velk/interface/intf_object.h>
+
+#include <cstddef>
+
+namespace velk {
+
+/** @brief Controls when scatter() fires on_changed for the written objects. */
+enum class ScatterNotify : uint8_t
+{
+    Immediate, ///< Notify each object right after its value is written.
+    Batched,   ///< Write all values first, then notify each written object.
+    None       ///< Do not notify.
+};
+
+namespace detail {
+
+inline IObject* bulk_object(IObject* object) { return object; }
+inline IObject* bulk_object(const IObject::Ptr& object) { return object.get(); }
+
+/**
+ * @brief Caches the byte offset from an object to a State member for the last seen class.
+ *
+ * Objects of the same class share a layout, so the member is resolved once per run of
+ * same-class objects (e.g. all objects of a hive) and then reached by pointer arithmetic.
+ * Switching classes re-resolves. Objects must be passed by their canonical IObject
+ * pointer (as returned by IObject::Ptr or interface_cast<IObject>).
+ */
+class BulkMemberCache
+{
+public:
+    /**
+     * @brief Returns the address of the member in @p object, or nullptr if its class has none.
+     * @param resolve Callable as char*(IObject&, Uid& interfaceUid); called on a class change.
+     */
+    template <class Resolve>
+    char* find(IObject& object, Resolve& resolve)
+    {
+        Uid cls = object.get_class_uid();
+        if (!cached_ || cls != class_) {
+            class_ = cls;
+            cached_ = true;
+            char* member = resolve(object, interface_);
+            found_ = member != nullptr;
+            offset_ = found_ ? member - reinterpret_cast<char*>(&object) : 0;
+        }
+        return found_ ? reinterpret_cast<char*>(&object) + offset_ : nullptr;
+    }
+
+    /** @brief Returns the UID of the interface that declares the member in the last resolved class. */
+    Uid interface_uid() const { return interface_; }
+
+private:
+    Uid class_;
+    Uid interface_;
+    ptrdiff_t offset_{};
+    bool cached_{};
+    bool found_{};
+};
+
+/** @brief Returns the address of the @p state member of interface @p Intf in @p object. */
+template <class Intf, class T>
+char* resolve_state_member(IObject& object, T Intf::State::*member)
+{
+    auto* ps = interface_cast<IPropertyState>(&object);
+    auto* state = ps ? ps->template get_property_state<Intf>() : nullptr;
+    return state ? reinterpret_cast<char*>(&(state->*member)) : nullptr;
+}
+
+/**
+ * @brief Returns the address of the State member backing property @p name in @p object.
+ *
+ * Looks the name up in the static metadata of the object's class. Returns nullptr if the
+ * property does not exist, is not of type @p type, or is read-only and @p writable is set.
+ */
+inline char* resolve_state_member(IObject& object, string_view name, uint64_t nameHash, Uid type,
+                                  bool writable, Uid& interfaceUid)
+{
+    auto* meta = interface_cast<IMetadata>(&object);
+    if (!meta) {
+        return nullptr;
+    }
+    for (auto& m : meta->get_static_metadata()) {
+        if (m.nameHash != nameHash || m.name != name) {
+            continue;
+        }
+        auto* pk = m.propertyKind();
+        if (!pk || !pk->getOffset || !m.interfaceInfo || pk->typeUid != type ||
+            (writable && (pk->flags & ObjectFlags::ReadOnly))) {
+            continue;
+        }
+        auto* state = static_cast<char*>(meta->get_property_state(m.interfaceInfo->uid));
+        if (state) {
+            interfaceUid = m.interfaceInfo->uid;
+            return state + pk->getOffset();
+        }
+    }
+    return nullptr;
+}
+
+inline void notify_state_changed(IObject& object, Uid interfaceUid)
+{
+    if (auto* meta = interface_cast<IMetadata>(&object)) {
+        meta->notify(MemberKind::Property, interfaceUid, Notification::Changed);
+    }
+}
+
+template <class T, class Obj, class Resolve>
+size_t gather_impl(array_view<Obj> objects, T* out, Resolve resolve)
+{
+    BulkMemberCache cache;
+    size_t count = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        auto* object = bulk_object(objects[i]);
+        if (!object) {
+            continue;
+        }
+        if (auto* member = cache.find(*object, resolve)) {
+            out[i] = *reinterpret_cast<const T*>(member);
+            ++count;
+        }
+    }
+    return count;
+}
+
+template <class T, class Obj, class Resolve>
+size_t scatter_impl(array_view<Obj> objects, const T* values, ScatterNotify notify, Resolve resolve)
+{
+    BulkMemberCache cache;
+    size_t count = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        auto* object = bulk_object(objects[i]);
+        if (!object) {
+            continue;
+        }
+        if (auto* member = cache.find(*object, resolve)) {
+            *reinterpret_cast<T*>(member) = values[i];
+            ++count;
+            if (notify == ScatterNotify::Immediate) {
+                notify_state_changed(*object, cache.interface_uid());
+            }
+        }
+    }
+    if (notify == ScatterNotify::Batched && count) {
+        for (auto& o : objects) {
+            auto* object = bulk_object(o);
+            if (object && cache.find(*object, resolve)) {
+                notify_state_changed(*object, cache.interface_uid());
+            }
+        }
+    }
+    return count;
+}
+
+template <class Intf, class T>
+auto member_resolver(T Intf::State::*member)
+{
+    return [member](IObject& object, Uid& interfaceUid) {
+        interfaceUid = Intf::UID;
+        return resolve_state_member<Intf>(object, member);
+    };
+}
+
+template <class T>
+auto name_resolver(string_view name, bool writable)
+{
+    return [name, hash = hash_string(name), writable](IObject& object, Uid& interfaceUid) {
+        return resolve_state_member(object, name, hash, type_uid<T>(), writable, interfaceUid);
+    };
+}
+
+} // namespace detail
+
+/**
+ * @brief Reads the @p member of interface @p Intf's State from every object into @p out.
+ *
+ * The member is resolved once per class, then copied with pointer arithmetic, without
+ * per-object virtual calls beyond get_class_uid(). Works for objects inside and outside
+ * hives. Like read_state(), this reads the State directly, bypassing property extensions.
+ *
+ * @code
+ * vector<float> widths(objects.size());
+ * gather<IMyWidget>(objects, &IMyWidget::State::width, widths.data());
+ * @endcode
+ *
+ * @param objects Objects to read. Null objects are skipped.
+ * @param member Pointer to the State member to read.
+ * @param out Receives objects.size() values; entries of objects without the member are left untouched.
+ * @return The number of values read.
+ */
+template <class Intf, class T>
+size_t gather(array_view<IObject*> objects, T Intf::State::*member, T* out)
+{
+    return detail::gather_impl(objects, out, detail::member_resolver<Intf>(member));
+}
+
+/** @copydoc gather(array_view<IObject*>, T Intf::State::*, T*) */
+template <class Intf, class T>
+size_t gather(array_view<IObject::Ptr> objects, T Intf::State::*member, T* out)
+{
+    return detail::gather_impl(objects, out, detail::member_resolver<Intf>(member));
+}
+
+/**
+ * @brief Reads the property @p name of type @p T from every object into @p out.
+ *
+ * Like the member pointer overload, but resolves the property by name through each
+ * class's static metadata, so objects may declare it in different interfaces.
+ */
+template <class T>
+size_t gather(array_view<IObject*> objects, string_view name, T* out)
+{
+    return detail::gather_impl(objects, out, detail::name_resolver<T>(name, false));
+}
+
+/** @copydoc gather(array_view<IObject*>, string_view, T*) */
+template <class T>
+size_t gather(array_view<IObject::Ptr> objects, string_view name, T* out)
+{
+    return detail::gather_impl(objects, out, detail::name_resolver<T>(name, false));
+}
+
+/**
+ * @brief Writes @p values[i] to the @p member of interface @p Intf's State of objects[i].
+ *
+ * The member is resolved once per class, then written with pointer arithmetic. Like
+ * write_state(), notifications broadcast Changed for the properties of @p Intf, and
+ * property extensions (e.g. transitions) are bypassed.
+ *
+ * @param objects Objects to write. Null objects are skipped.
+ * @param member Pointer to the State member to write.
+ * @param values objects.size() values.
+ * @param notify When to fire on_changed. Batched writes all objects before notifying any,
+ *               so handlers observe the final value of every object.
+ * @return The number of values written.
+ */
+template <class Intf, class T>
+size_t scatter(array_view<IObject*> objects, T Intf::State::*member, const T* values,
+               ScatterNotify notify = ScatterNotify::Immediate)
+{
+    return detail::scatter_impl(objects, values, notify, detail::member_resolver<Intf>(member));
+}
+
+/** @copydoc scatter(array_view<IObject*>, T Intf::State::*, const T*, ScatterNotify) */
+template <class Intf, class T>
+size_t scatter(array_view<IObject::Ptr> objects, T Intf::State::*member, const T* values,
+               ScatterNotify notify = ScatterNotify::Immediate)
+{
+    return detail::scatter_impl(objects, values, notify, detail::member_resolver<Intf>(member));
+}
+
+/**
+ * @brief Writes @p values[i] to the property @p name of objects[i].
+ *
+ * Like the member pointer overload, but resolves the property by name through each
+ * class's static metadata. Read-only properties are skipped.
+ */
+template <class T>
+size_t scatter(array_view<IObject*> objects, string_view name, const T* values,
+               ScatterNotify notify = ScatterNotify::Immediate)
+{
+    return detail::scatter_impl(objects, values, notify, detail::name_resolver<T>(name, true));
+}
+
+/** @copydoc scatter(array_view<IObject*>, string_view, const T*, ScatterNotify) */
+template <class T>
+size_t scatter(array_view<IObject::Ptr> objects, string_view name, const T* values,
+               ScatterNotify notify = ScatterNotify::Immediate)
+{
+    return detail::scatter_impl(objects, values, notify, detail::name_resolver<T>(name, true));
+}
+
+} // namespace velk
+
+#endif // VELK_API_BULK_H
@@ -59,12 +59,12 @@ public:
             return succeeded(other.get_data(buf, elem_size, type_uid)) ? set_value(storage, buf, elem_size)
                                                                        : ReturnValue::Fail;
         }
-        void* heap_buf = std::malloc(elem_size);
+        void* heap_buf = allocate(elem_size);
         ReturnValue ret = ReturnValue::Fail;
         if (heap_buf && succeeded(other.get_data(heap_buf, elem_size, type_uid))) {
             ret = set_value(storage, heap_buf, elem_size);
         }
-        std::free(heap_buf);
+        deallocate(heap_buf, elem_size);
         return ret;
     }
 };
@@ -171,6 +171,12 @@ public:
         auto clone = FinalClass::get_factory().template create_instance<IAny>();
         return clone && succeeded(clone->copy_from(*this)) ? clone : nullptr;
     }
+
+    /** @brief Not supported by default. AnyCore implements it for trivially copyable types. */
+    ReturnValue clone_into(AnyBuffer&) const override { return ReturnValue::Fail; }
+
+    /** @brief Not supported by default. AnyValue and AnyRef expose their storage. */
+    void* get_data_pointer(Uid) override { return nullptr; }
 };
 
 /**
@@ -195,6 +201,9 @@ public:
     static constexpr Uid class_id() { return TYPE_UID; }
 };
 
+template <class T>
+class AnyValue;
+
 /**
  * @brief A helper template for implementing an Any which supports a single type
  */
@@ -280,6 +289,20 @@ public:
         }
     }
 
+    ReturnValue clone_into(AnyBuffer& buffer) const override
+    {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (buffer.data && buffer.capacity >= sizeof(T)) {
+                std::memcpy(buffer.data, &get_value(), sizeof(T));
+                buffer.size = sizeof(T);
+                buffer.type = TYPE_UID;
+                buffer.factory = &AnyValue<T>::get_factory();
+                return ReturnValue::Success;
+            }
+        }
+        return ReturnValue::Fail;
+    }
+
 private:
     static bool is_valid_args(const void* from, size_t fromSize, Uid type) noexcept
     {
@@ -296,6 +319,8 @@ class AnyValue final : public AnyCore<AnyValue<T>, T>
 public:
     const T& get_value() const override { return data_; }
 
+    void* get_data_pointer(Uid type) override { return type == AnyValue::TYPE_UID ? &data_ : nullptr; }
+
 private:
     T data_{};
 };
@@ -319,6 +344,8 @@ public:
 
     const T& get_value() const override { return *ptr_; }
 
+    void* get_data_pointer(Uid type) override { return type == AnyRef::TYPE_UID ? ptr_ : nullptr; }
+
     /** @brief Clones as an owned AnyValue<T> (snapshot of the referenced data). */
     IAny::Ptr clone() const override
     {
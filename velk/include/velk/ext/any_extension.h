@@ -84,6 +84,14 @@ public: // IAny passthrough defaults
 
     IAny::Ptr clone() const override { return inner_ ? inner_->clone() : nullptr; }
 
+    ReturnValue clone_into(AnyBuffer& buffer) const override
+    {
+        return inner_ ? inner_->clone_into(buffer) : ReturnValue::Fail;
+    }
+
+    /** @brief Returns nullptr: writing the inner's storage directly would bypass the extension. */
+    void* get_data_pointer(Uid) override { return nullptr; }
+
 protected:
     IAny::Ptr inner_;
 };
@@ -36,6 +36,7 @@ IObject::Ptr make_object(uint32_t flags = ObjectFlags::None)
     if (block && !block->get_ptr()) {
         block->set_ptr(result.get());
     }
+    detail::BlockAccess::apply_confinement(*obj);
     return result;
 }
 
@@ -57,10 +58,11 @@ template <class FinalClass>
 class ObjectFactory : public InterfaceDispatch<IObjectFactory>
 {
 public:
-    ObjectFactory() = default;
+    ObjectFactory() : type_index_(detail::type_index(FinalClass::class_id())) {}
     ~ObjectFactory() override = default;
 
 public:
+    TypeIndex get_type_index() const override { return type_index_; }
     IObject::Ptr create_instance(uint32_t flags = ObjectFlags::None) const override
     {
         return make_object<FinalClass>(flags);
@@ -82,6 +84,9 @@ public:
     {
         static_cast<FinalClass*>(location)->~FinalClass();
     }
+
+private:
+    TypeIndex type_index_;
 };
 
 /**
@@ -164,7 +169,12 @@ public: // IObject
     /** @brief Returns a shared_ptr to this object, or empty if expired. */
     IObject::Ptr get_self() const override { return detail::make_self_ptr(this->get_block()); }
 
-    uint32_t get_object_flags() const override { return this->get_object_data().flags; }
+    uint32_t get_object_flags() const override
+    {
+        auto flags = this->get_object_data().flags;
+        // share() promotes the block without touching the object, so report the block's state.
+        return this->get_block()->is_local() ? flags : flags & ~ObjectFlags::ThreadConfined;
+    }
 
     template <class T>
     typename T::Ptr get_self() const
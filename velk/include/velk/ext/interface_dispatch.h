@@ -5,6 +5,7 @@
 #include <velk/common.h>
 #include <velk/interface/intf_interface.h>
 
+#include <cstdint>
 #include <type_traits>
 
 namespace velk::ext {
@@ -14,8 +15,8 @@ namespace velk::ext {
  *
  * Inherits all Interfaces and dispatches get_interface queries by UID.
  * At compile time, builds a flat table of all reachable interfaces (including parents)
- * with corresponding cast function pointers. At runtime, get_interface() is a simple
- * linear scan of this table.
+ * with corresponding cast function pointers, plus a perfect hash over their UIDs. At
+ * runtime, get_interface() is a single hash slot load and UID compare.
  *
  * ref and unref are no-ops; override them in a derived class (e.g.
  * RefCountedDispatch) to add lifetime management.
@@ -63,12 +64,39 @@ private:
         return static_cast<Target*>(static_cast<Root*>(self));
     }
 
+    /** @brief Cast function for IInterface::UID: every object is its own IInterface. */
+    static IInterface* cast_self(Self* self) { return static_cast<IInterface*>(static_cast<void*>(self)); }
+
+    /** @brief Number of lookup entries: every reachable interface plus IInterface. */
+    static constexpr size_t lookup_size_ = max_interface_count_ + 1;
+
+    /** @brief Returns the smallest power of two that is >= @p n. */
+    static constexpr size_t pow2_at_least(size_t n)
+    {
+        size_t p = 1;
+        while (p < n) {
+            p *= 2;
+        }
+        return p;
+    }
+
+    /** @brief Size of the hash slot array. At most 1/4 full, which makes a perfect hash easy to find. */
+    static constexpr size_t hash_capacity_ = pow2_at_least(lookup_size_ * 4);
+
+    static_assert(lookup_size_ <= 255, "InterfaceDispatch supports at most 254 interfaces");
+
     /**
-     * @brief Compile-time storage for the flat interface dispatch table.
+     * @brief Compile-time storage for the interface dispatch tables.
      *
-     * Holds parallel arrays of InterfaceInfo (uid + name) and CastFn pointers.
-     * Built by make_interface_list() via fold expression over the interface pack.
+     * Holds parallel arrays of InterfaceInfo (uid + name) and CastFn pointers in declaration
+     * order, built by make_interface_list() via fold expression over the interface pack.
      * Entries are deduplicated by UID (first occurrence wins).
+     *
+     * finalize() then builds the lookup table used by get_interface(): the same entries plus
+     * IInterface::UID, and a perfect hash over them. UIDs are FNV hashes or random UUIDs, so
+     * a window of bits of the low word is already well distributed; finalize() searches for a
+     * shift and mask under which every entry lands in its own slot, and the slot stores the
+     * entry index. Empty slots point at the IInterface entry, which then fails the UID compare.
      */
     struct InterfaceListData
     {
@@ -77,6 +105,13 @@ private:
         CastFn casts[interface_list_size_]{};
         size_t count{0};
 
+        Uid lookup_uids[lookup_size_]{};       ///< IInterface::UID followed by entries[].uid.
+        CastFn lookup_casts[lookup_size_]{};   ///< Cast function for each lookup_uids entry.
+        size_t lookup_count{0};                ///< Number of valid lookup entries (count + 1).
+        uint8_t slots[hash_capacity_]{};       ///< Hash slot to lookup entry index.
+        uint64_t hash_mask{};                  ///< Slot mask, 0 if no perfect hash was found.
+        uint32_t hash_shift{};                 ///< Right shift applied to Uid::lo before masking.
+
         /** @brief Returns true if the given UID is already in the list. */
         constexpr bool contains(Uid uid) const
         {
@@ -97,6 +132,44 @@ private:
                 count++;
             }
         }
+
+        /** @brief Returns true if all lookup entries map to distinct slots under @p shift and @p mask. */
+        constexpr bool is_perfect(uint32_t shift, uint64_t mask) const
+        {
+            bool used[hash_capacity_]{};
+            for (size_t i = 0; i < lookup_count; ++i) {
+                auto slot = static_cast<size_t>((lookup_uids[i].lo >> shift) & mask);
+                if (used[slot]) {
+                    return false;
+                }
+                used[slot] = true;
+            }
+            return true;
+        }
+
+        /** @brief Builds the lookup table and searches for the smallest perfect hash. */
+        constexpr void finalize()
+        {
+            lookup_uids[0] = IInterface::UID;
+            lookup_casts[0] = &cast_self;
+            for (size_t i = 0; i < count; ++i) {
+                lookup_uids[i + 1] = entries[i].uid;
+                lookup_casts[i + 1] = casts[i];
+            }
+            lookup_count = count + 1;
+            for (size_t size = pow2_at_least(lookup_count); size <= hash_capacity_; size *= 2) {
+                for (uint32_t shift = 0; shift + 8 <= 64; ++shift) {
+                    if (is_perfect(shift, size - 1)) {
+                        hash_shift = shift;
+                        hash_mask = size - 1;
+                        for (size_t i = 0; i < lookup_count; ++i) {
+                            slots[(lookup_uids[i].lo >> shift) & hash_mask] = static_cast<uint8_t>(i);
+                        }
+                        return;
+                    }
+                }
+            }
+        }
     };
 
     /**
@@ -122,6 +195,7 @@ private:
     {
         InterfaceListData list{};
         (collect_chain<Interfaces, Interfaces>(list), ...);
+        list.finalize();
         return list;
     }
 
@@ -132,21 +206,26 @@ public:
     /**
      * @brief Resolves a UID to the corresponding interface pointer.
      *
-     * For IInterface::UID, returns this (every object implements IInterface).
-     * For all other UIDs, scans the flat interface table and invokes the
-     * matching cast function, or returns nullptr if not found.
+     * Looks the UID up in the compile-time perfect hash (which includes IInterface::UID,
+     * resolving to this) and invokes the matching cast function, or returns nullptr if
+     * not found. The cost is one slot load and one UID compare, regardless of how many
+     * interfaces the class implements. Falls back to a linear scan in the (practically
+     * impossible) case that no perfect hash was found for the class.
      */
     IInterface* get_interface(Uid uid) override
     {
-        if (uid == IInterface::UID) {
-            return static_cast<IInterface*>(static_cast<void*>(this));
-        }
-        for (size_t i = 0; i < class_interface_data_.count; ++i) {
-            if (class_interface_data_.entries[i].uid == uid) {
-                return class_interface_data_.casts[i](this);
+        constexpr auto& data = class_interface_data_;
+        if constexpr (data.hash_mask != 0) {
+            size_t i = data.slots[(uid.lo >> data.hash_shift) & data.hash_mask];
+            return data.lookup_uids[i] == uid ? data.lookup_casts[i](this) : nullptr;
+        } else {
+            for (size_t i = 0; i < data.lookup_count; ++i) {
+                if (data.lookup_uids[i] == uid) {
+                    return data.lookup_casts[i](this);
+                }
             }
+            return nullptr;
         }
-        return nullptr;
     }
     /** @copydoc get_interface(Uid) */
     const IInterface* get_interface(Uid uid) const override
@@ -13,6 +13,14 @@ template <class T>
 struct has_class_id<T, std::void_t<decltype(T::class_id())>> : std::true_type
 {};
 
+/** @brief Check if class has a static 'UID' member (interfaces). */
+template <class T, class = void>
+struct has_static_uid : std::false_type
+{};
+template <class T>
+struct has_static_uid<T, std::void_t<decltype(T::UID)>> : std::true_type
+{};
+
 /** @brief Check if class has 'class_uid' member. */
 template <class T, class = void>
 struct has_class_uid : std::false_type
@@ -47,6 +47,10 @@ protected:
     {
         return storage_ ? storage_->get_function(name, mode) : nullptr;
     }
+    IInterface::Ptr storage_get_member(size_t index, Resolve mode = Resolve::Create) const
+    {
+        return storage_ ? storage_->get_member(index, mode) : nullptr;
+    }
     void storage_notify(MemberKind kind, Uid interfaceUid, Notification notification) const
     {
         if (storage_) {
@@ -136,6 +140,14 @@ public: // IMetadata overrides
         ensure_stor();
         return storage_get_function(name, mode);
     }
+    IInterface::Ptr get_member(size_t index, Resolve mode = Resolve::Create) const override
+    {
+        if (mode == Resolve::Existing && !storage_) {
+            return {};
+        }
+        ensure_stor();
+        return storage_get_member(index, mode);
+    }
     void notify(MemberKind kind, Uid interfaceUid, Notification notification) const override
     {
         // No need to ensure storage. If container has not been initialized there won't be anything
@@ -34,10 +34,10 @@ template <class... Interfaces>
 class RefCountedDispatch : public InterfaceDispatch<Interfaces...>
 {
 public:
-    /** @brief Atomically increments the reference count. */
+    /** @brief Increments the reference count (atomically unless thread-confined). */
     void ref() override { data_.block->add_ref(); }
 
-    /** @brief Atomically decrements the reference count; deletes the object at zero. */
+    /** @brief Decrements the reference count (atomically unless thread-confined); deletes at zero. */
     void unref() override
     {
         if (data_.block->release_ref()) {
@@ -108,6 +108,22 @@ struct BlockAccess
     {
         obj.get_object_data().flags = flags;
     }
+
+    /**
+     * @brief Switches the object's control block to non-atomic counting if it was
+     *        created with ObjectFlags::ThreadConfined. Debug builds record the owning thread.
+     */
+    template <class T>
+    static void apply_confinement(T& obj) noexcept
+    {
+        auto& data = obj.get_object_data();
+        if (data.flags & ObjectFlags::ThreadConfined) {
+            data.block->set_local_tag();
+#ifndef NDEBUG
+            set_local_owner(data.block, current_thread_tag());
+#endif
+        }
+    }
 };
 
 } // namespace detail
@@ -0,0 +1,293 @@
+#ifndef VELK_INLINE_ANY_H
+#define VELK_INLINE_ANY_H
+
+#include <velk/ext/interface_dispatch.h>
+#include <velk/interface/intf_any.h>
+#include <velk/interface/intf_object_factory.h>
+
+#include <cstddef>
+#include <cstring>
+
+namespace velk {
+
+/**
+ * @brief IAny that stores small trivially copyable values inline, without an object allocation.
+ *
+ * assign() first asks the source to copy its value into the inline buffer with
+ * IAny::clone_into(). If the source does not support that (the value is not trivially
+ * copyable or is larger than @p N bytes), it falls back to holding a heap clone() of the
+ * source and forwards all IAny calls to it, so any value can be stored.
+ *
+ * InlineAny is a plain C++ value (copyable, movable) for use as a member or on the stack.
+ * It is not reference counted: ref() and unref() are no-ops, so it must never be wrapped
+ * in a shared_ptr. Call clone() or get_self() to get an owned IAny::Ptr copy.
+ *
+ * An inline value reports the class UID of the IAny it was copied from, so it looks like
+ * the AnyValue it replaces. The factory used by clone() is not owned and must outlive
+ * the InlineAny.
+ *
+ * @tparam N Size of the inline buffer in bytes.
+ */
+template <size_t N = 16>
+class InlineAny final : public ext::InterfaceDispatch<IAny>
+{
+public:
+    /** @brief Constructs an empty InlineAny (no compatible types). */
+    InlineAny() = default;
+    /** @brief Constructs an InlineAny holding a copy of @p src. */
+    explicit InlineAny(const IAny& src) { assign(src); }
+    /** @brief Copy constructor. Copies the inline bytes, or clones a heap-held value. */
+    InlineAny(const InlineAny& other) : ext::InterfaceDispatch<IAny>() { copy(other); }
+    /** @brief Move constructor. Steals a heap-held value. */
+    InlineAny(InlineAny&& other) noexcept : ext::InterfaceDispatch<IAny>() { take(other); }
+    /** @brief Copy assignment. */
+    InlineAny& operator=(const InlineAny& other)
+    {
+        if (this != &other) {
+            copy(other);
+        }
+        return *this;
+    }
+    /** @brief Move assignment. */
+    InlineAny& operator=(InlineAny&& other) noexcept
+    {
+        if (this != &other) {
+            take(other);
+        }
+        return *this;
+    }
+    ~InlineAny() override = default;
+
+    /** @brief Size of the inline buffer in bytes. */
+    static constexpr size_t inline_capacity = N;
+
+    /**
+     * @brief Replaces the contents with a copy of @p src.
+     * @return true if a value is held afterwards (inline or on the heap).
+     */
+    bool assign(const IAny& src)
+    {
+        heap_ = nullptr;
+        AnyBuffer buffer{data_, N, 0, {}, nullptr};
+        if (succeeded(src.clone_into(buffer))) {
+            type_ = buffer.type;
+            size_ = buffer.size;
+            factory_ = buffer.factory;
+            class_uid_ = src.get_class_uid();
+            return true;
+        }
+        reset();
+        heap_ = src.clone();
+        return !!heap_;
+    }
+
+    /**
+     * @brief Replaces the contents with a heap clone() of @p src, even if it would fit inline.
+     * @return true if a value is held afterwards.
+     */
+    bool assign_clone(const IAny& src)
+    {
+        reset();
+        heap_ = src.clone();
+        return !!heap_;
+    }
+
+    /**
+     * @brief Replaces the contents with @p size raw bytes of a trivially copyable value of type @p type.
+     * @param factory Factory that clone() uses to create an owned copy, may be nullptr.
+     * @return false if the value does not fit in the inline buffer.
+     */
+    bool assign_data(const void* data, size_t size, Uid type, const IObjectFactory* factory = nullptr)
+    {
+        reset();
+        if (!data || !size || size > N) {
+            return false;
+        }
+        std::memcpy(data_, data, size);
+        type_ = type;
+        size_ = size;
+        factory_ = factory;
+        class_uid_ = factory ? factory->get_class_info().uid : Uid{};
+        return true;
+    }
+
+    /** @brief Replaces the factory that clone() uses for an inline value. */
+    void set_factory(const IObjectFactory* factory) { factory_ = factory; }
+
+    /** @brief Releases the held value. */
+    void reset()
+    {
+        heap_ = nullptr;
+        type_ = {};
+        size_ = 0;
+        factory_ = nullptr;
+        class_uid_ = {};
+    }
+
+    /** @brief Returns true if no value is held. */
+    bool empty() const { return !heap_ && size_ == 0; }
+    /** @brief Returns true if a value is held. */
+    explicit operator bool() const { return !empty(); }
+    /** @brief Returns true if the value is stored in the inline buffer. */
+    bool is_inline() const { return !heap_ && size_ > 0; }
+
+    // IObject
+    /** @brief Returns the class UID of the IAny the value was copied from, or that of InlineAny if unknown. */
+    Uid get_class_uid() const override
+    {
+        if (heap_) {
+            return heap_->get_class_uid();
+        }
+        return class_uid_ != Uid{} ? class_uid_ : type_uid<InlineAny>();
+    }
+    /** @brief Returns the class name of the held value's factory (or heap clone), or that of InlineAny if unknown. */
+    string_view get_class_name() const override
+    {
+        if (heap_) {
+            return heap_->get_class_name();
+        }
+        return factory_ ? factory_->get_class_info().name : get_name<InlineAny>();
+    }
+    /**
+     * @brief Returns null: an InlineAny is not reference counted, so there is no self pointer.
+     *
+     * Use clone() to take an owned copy of the value.
+     */
+    IObject::Ptr get_self() const override { return {}; }
+    uint32_t get_object_flags() const override { return ObjectFlags::None; }
+
+    // IAny
+    array_view<Uid> get_compatible_types() const override
+    {
+        if (heap_) {
+            return heap_->get_compatible_types();
+        }
+        return size_ ? array_view<Uid>{&type_, 1} : array_view<Uid>{};
+    }
+
+    size_t get_data_size(Uid type) const override
+    {
+        if (heap_) {
+            return heap_->get_data_size(type);
+        }
+        return size_ && type == type_ ? size_ : 0;
+    }
+
+    ReturnValue get_data(void* to, size_t toSize, Uid type) const override
+    {
+        if (heap_) {
+            return heap_->get_data(to, toSize, type);
+        }
+        if (!is_valid_args(to, toSize, type)) {
+            return ReturnValue::Fail;
+        }
+        std::memcpy(to, data_, size_);
+        return ReturnValue::Success;
+    }
+
+    ReturnValue set_data(void const* from, size_t fromSize, Uid type) override
+    {
+        if (heap_) {
+            return heap_->set_data(from, fromSize, type);
+        }
+        if (!is_valid_args(from, fromSize, type)) {
+            return ReturnValue::Fail;
+        }
+        if (std::memcmp(data_, from, size_) == 0) {
+            return ReturnValue::NothingToDo;
+        }
+        std::memcpy(data_, from, size_);
+        return ReturnValue::Success;
+    }
+
+    /** @brief Copies the value of @p other. An empty InlineAny adopts the type of @p other. */
+    ReturnValue copy_from(const IAny& other) override
+    {
+        if (heap_) {
+            return heap_->copy_from(other);
+        }
+        if (!size_) {
+            return assign(other) ? ReturnValue::Success : ReturnValue::Fail;
+        }
+        alignas(std::max_align_t) unsigned char tmp[N];
+        AnyBuffer buffer{tmp, N, 0, {}, nullptr};
+        if (succeeded(other.clone_into(buffer))) {
+            return buffer.type == type_ && buffer.size == size_ ? set_data(tmp, size_, type_) : ReturnValue::Fail;
+        }
+        // The source cannot copy raw bytes, but may still convert to our type through get_data()
+        return succeeded(other.get_data(tmp, size_, type_)) ? set_data(tmp, size_, type_) : ReturnValue::Fail;
+    }
+
+    IAny::Ptr clone() const override
+    {
+        if (heap_) {
+            return heap_->clone();
+        }
+        if (!factory_) {
+            return nullptr;
+        }
+        auto c = factory_->template create_instance<IAny>();
+        return c && !failed(c->set_data(data_, size_, type_)) ? c : nullptr;
+    }
+
+    ReturnValue clone_into(AnyBuffer& buffer) const override
+    {
+        if (heap_) {
+            return heap_->clone_into(buffer);
+        }
+        if (!size_ || !buffer.data || buffer.capacity < size_) {
+            return ReturnValue::Fail;
+        }
+        std::memcpy(buffer.data, data_, size_);
+        buffer.size = size_;
+        buffer.type = type_;
+        buffer.factory = factory_;
+        return ReturnValue::Success;
+    }
+
+    void* get_data_pointer(Uid type) override
+    {
+        if (heap_) {
+            return heap_->get_data_pointer(type);
+        }
+        return size_ && type == type_ ? data_ : nullptr;
+    }
+
+private:
+    bool is_valid_args(const void* p, size_t size, Uid type) const
+    {
+        return p && size_ && size == size_ && type == type_;
+    }
+
+    void copy(const InlineAny& other)
+    {
+        heap_ = other.heap_ ? other.heap_->clone() : nullptr;
+        type_ = other.type_;
+        size_ = other.size_;
+        factory_ = other.factory_;
+        class_uid_ = other.class_uid_;
+        std::memcpy(data_, other.data_, N);
+    }
+
+    void take(InlineAny& other)
+    {
+        heap_ = std::move(other.heap_);
+        type_ = other.type_;
+        size_ = other.size_;
+        factory_ = other.factory_;
+        class_uid_ = other.class_uid_;
+        std::memcpy(data_, other.data_, N);
+        other.reset();
+    }
+
+    IAny::Ptr heap_;                  ///< Heap clone, for values that cannot be stored inline.
+    Uid type_;                        ///< Type of the inline value.
+    size_t size_{};                   ///< Size of the inline value, 0 if none.
+    const IObjectFactory* factory_{}; ///< Factory used by clone() for the inline value.
+    Uid class_uid_;                   ///< Class UID of the IAny the inline value was copied from.
+    alignas(std::max_align_t) unsigned char data_[N]{}; ///< Inline value bytes.
+};
+
+} // namespace velk
+
+#endif // VELK_INLINE_ANY_H
@@ -4,6 +4,7 @@
 #include <velk/interface/intf_object.h>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace velk {
 
@@ -41,6 +42,21 @@ struct HivePageCapacity
     size_t page_n{1024u};
 };
 
+/**
+ * @brief Describes the slot memory of one hive page.
+ *
+ * Slot i of the page starts at slots + i * stride and holds a live element if bit
+ * (i % 64) of active_bits[i / 64] is set. The bitmask has (capacity + 63) / 64 words.
+ */
+struct HivePageView
+{
+    void* slots{};                 ///< Address of the first slot.
+    size_t stride{};               ///< Distance between consecutive slots in bytes.
+    size_t capacity{};             ///< Number of slots in the page.
+    size_t live{};                 ///< Number of set bits in active_bits.
+    const uint64_t* active_bits{}; ///< Active-slot bitmask, one bit per slot.
+};
+
 /** @brief Specifies the type of a hive. */
 enum class HiveType : uint8_t
 {
@@ -82,6 +98,17 @@ public:
      */
     virtual void set_page_capacity(const HivePageCapacity& capacity) = 0;
 
+    /** @brief Returns the number of allocated pages. */
+    virtual size_t get_page_count() const = 0;
+
+    /**
+     * @brief Describes page @p index, for scanning elements without a callback per element.
+     * @note The view stays valid until the hive is modified: adding an element may reuse a
+     *       free slot in any page, and clearing a raw hive releases its pages.
+     * @return false if @p index is out of range.
+     */
+    virtual bool get_page(size_t index, HivePageView& out) const = 0;
+
     /**
      * @brief Removes all elements from the hive.
      *
@@ -8,6 +8,22 @@
 
 namespace velk {
 
+class IObjectFactory;
+
+/**
+ * @brief Destination of IAny::clone_into(): a raw buffer receiving a trivially copyable value.
+ *
+ * The caller fills in @c data and @c capacity. On success the source fills in the rest.
+ */
+struct AnyBuffer
+{
+    void* data{};                    ///< Destination buffer.
+    size_t capacity{};               ///< Size of @c data in bytes.
+    size_t size{};                   ///< Number of bytes written.
+    Uid type;                        ///< Type of the value written.
+    const IObjectFactory* factory{}; ///< Factory of an owned IAny that can hold the value (for clone()).
+};
+
 /**
  * @brief Type-erased value container interface.
  *
@@ -58,6 +74,27 @@ public:
      * @return A new IAny with the same data, or null if cloning fails.
      */
     virtual IAny::Ptr clone() const = 0;
+    /**
+     * @brief Copies the contained value into a raw buffer, without creating an object.
+     *
+     * Only values of trivially copyable types are supported, so the bytes can later be
+     * copied and discarded freely. Used by InlineAny to avoid heap-allocating a clone.
+     * @param buffer The destination. @c data and @c capacity must be set by the caller.
+     * @return Success if the value was written, Fail if the value is not trivially copyable,
+     *         does not fit into the buffer, or the implementation does not support it.
+     */
+    virtual ReturnValue clone_into(AnyBuffer& buffer) const = 0;
+    /**
+     * @brief Returns a pointer to the storage of the contained value, if it is directly addressable.
+     *
+     * Lets bulk writers (e.g. the animator's batched tracks) write a value of @p type in place.
+     * Writes through the pointer bypass set_data(), so no change detection or side effects take
+     * place; the caller is responsible for notifying. Implementations that intercept reads or
+     * writes (e.g. property extensions) return nullptr.
+     * @param type Type of the value. Must be one of the values returned by get_compatible_types.
+     * @return The value storage, or nullptr if @p type is not held or the value is not addressable.
+     */
+    virtual void* get_data_pointer(Uid type) = 0;
 };
 
 /**
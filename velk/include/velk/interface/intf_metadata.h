@@ -113,6 +113,13 @@ public:
     virtual IEvent::Ptr get_event(string_view name, Resolve mode = Resolve::Create) const = 0;
     /** @brief Returns the runtime function instance for the named member, or nullptr. */
     virtual IFunction::Ptr get_function(string_view name, Resolve mode = Resolve::Create) const = 0;
+    /**
+     * @brief Returns the runtime instance of the member at @p index in get_static_metadata(), or nullptr.
+     *
+     * Skips the name lookup of the named getters. The index of a member is the same for all
+     * objects of a class, so callers can resolve it once from ClassInfo::members.
+     */
+    virtual IInterface::Ptr get_member(size_t index, Resolve mode = Resolve::Create) const = 0;
 
     /** @brief Broadcasts a notification to all instantiated members of the given kind and interface. */
     virtual void notify(MemberKind kind, Uid interfaceUid, Notification notification) const = 0;
@@ -360,11 +367,24 @@ State& default_state()
     return s;
 }
 
+/**
+ * @brief Returns the byte offset of the member @p mem within @p State.
+ *
+ * Measured on the default_state<State>() singleton, since offsetof cannot take a
+ * pointer-to-member.
+ */
+template <class State, class T>
+size_t state_member_offset(T State::*mem)
+{
+    auto& s = default_state<State>();
+    return static_cast<size_t>(reinterpret_cast<const char*>(&(s.*mem)) - reinterpret_cast<const char*>(&s));
+}
+
 /**
  * @brief Binds a pointer-to-member to PropertyKind function pointers.
  *
  * Given a State struct type and a pointer-to-member, PropBind generates a
- * @c static @c constexpr PropertyKind with @c getDefault and @c createRef
+ * @c static @c constexpr PropertyKind with @c getDefault, @c createRef and @c getOffset
  * functions. This replaces per-property boilerplate that the VELK_INTERFACE
  * macro previously generated inline.
  *
@@ -403,8 +423,11 @@ struct PropBind
         return ext::create_any_ref<value_type>(&(static_cast<State*>(base)->*Mem));
     }
 
+    /** @brief Returns the byte offset of the member within State. */
+    static size_t getOffset() { return state_member_offset<State>(Mem); }
+
     static constexpr PropertyKind kind{
-        type_uid<value_type>(), &getDefault, &createRef, Flags}; ///< Pre-built PropertyKind.
+        type_uid<value_type>(), &getDefault, &createRef, Flags, &getOffset}; ///< Pre-built PropertyKind.
 };
 
 /**
@@ -435,7 +458,9 @@ struct ArrBind
         return ext::create_array_any_ref<value_type>(&(static_cast<State*>(base)->*Mem));
     }
 
-    static constexpr PropertyKind baseKind{type_uid<vec_type>(), &getDefault, &createRef, Flags};
+    static size_t getOffset() { return state_member_offset<State>(Mem); }
+
+    static constexpr PropertyKind baseKind{type_uid<vec_type>(), &getDefault, &createRef, Flags, &getOffset};
 
     static constexpr ArrayPropertyKind kind{baseKind, type_uid<value_type>()};
 };
@@ -17,7 +17,12 @@ public:
     /** @brief Returns the name of the class. */
     virtual string_view get_class_name() const = 0;
 
-    /** @brief Returns a shared_ptr to this object, or empty if not available. */
+    /**
+     * @brief Returns a shared_ptr to this object, or empty if not available.
+     *
+     * A non-empty result always points to this object. Objects that are not reference
+     * counted on their own (ObjectStorage, InlineAny) return empty.
+     */
     virtual Ptr get_self() const = 0;
 
     /** @brief Returns the object's flags (bitwise combination of ObjectFlags). */
@@ -3,6 +3,7 @@
 
 #include <velk/interface/intf_object.h>
 #include <velk/interface/types.h>
+#include <velk/type_index.h>
 
 namespace velk {
 
@@ -14,6 +15,8 @@ public:
     virtual IObject::Ptr create_instance(uint32_t flags = ObjectFlags::None) const = 0;
     /** @brief Returns the ClassInfo describing the class this factory creates. */
     virtual const ClassInfo& get_class_info() const = 0;
+    /** @brief Returns the TypeIndex of the class UID, cached when the factory is constructed. */
+    virtual TypeIndex get_type_index() const = 0;
 
     /** @brief Returns the size (in bytes) of one instance. */
     virtual size_t get_instance_size() const = 0;
@@ -10,6 +10,15 @@ namespace velk {
 /** @brief Interpolation callback: interpolates between two type-erased values. */
 using InterpolatorFn = ReturnValue (*)(const IAny& from, const IAny& to, float t, IAny& result);
 
+/**
+ * @brief Bulk interpolation callback: interpolates @p count values stored in raw typed arrays.
+ *
+ * Computes out[i] = interpolate(from[i], to[i], t[i]) for i in [0, count), where @p from,
+ * @p to and @p out point to arrays of the registered value type and @p t holds the eased
+ * progress of each value.
+ */
+using BulkInterpolatorFn = void (*)(const void* from, const void* to, const float* t, void* out, size_t count);
+
 /**
  * @brief Interface for registering, unregistering, and querying object type factories.
  *
@@ -28,12 +37,27 @@ public:
     /** @brief Returns the factory for a registered type, or nullptr if not found. */
     virtual const IObjectFactory* find_factory(Uid classUid) const = 0;
 
-    /** @brief Registers an interpolator function for a given type UID. */
+    /**
+     * @brief Registers an interpolator function for a given type UID.
+     *
+     * Clears the bulk interpolator of the type unless it was registered by the same owner
+     * (the same plugin, or the application), so that a replaced interpolator is never bypassed
+     * by someone else's bulk one. Register a matching bulk variant afterwards to keep batching.
+     */
     virtual ReturnValue register_interpolator(Uid typeUid, InterpolatorFn fn) = 0;
-    /** @brief Unregisters a previously registered interpolator for a given type UID. */
+    /** @brief Unregisters the interpolator and the bulk interpolator for a given type UID. */
     virtual ReturnValue unregister_interpolator(Uid typeUid) = 0;
     /** @brief Finds the interpolator function for a given type UID, or nullptr if not registered. */
     virtual InterpolatorFn find_interpolator(Uid typeUid) const = 0;
+    /**
+     * @brief Registers a bulk interpolator for a given type UID.
+     *
+     * Optional companion of the single-value interpolator, used by animations that evaluate
+     * many values at once. Must produce the same results as the type's interpolator.
+     */
+    virtual ReturnValue register_bulk_interpolator(Uid typeUid, BulkInterpolatorFn fn) = 0;
+    /** @brief Finds the bulk interpolator for a given type UID, or nullptr if not registered. */
+    virtual BulkInterpolatorFn find_bulk_interpolator(Uid typeUid) const = 0;
 
     /**
      * @brief Registers an interpolator function for type T.
@@ -44,6 +68,15 @@ public:
     {
         return register_interpolator(type_uid<T>(), fn);
     }
+    /**
+     * @brief Registers a bulk interpolator function for type T.
+     * @tparam T The value type to associate the bulk interpolator with.
+     */
+    template <class T>
+    ReturnValue register_bulk_interpolator(BulkInterpolatorFn fn)
+    {
+        return register_bulk_interpolator(type_uid<T>(), fn);
+    }
     /**
      * @brief Unregisters a previously registered interpolator for type T.
      * @tparam T The value type whose interpolator should be removed.
@@ -1,6 +1,8 @@
 #ifndef INTF_VELK_H
 #define INTF_VELK_H
 
+#include <velk/allocator.h>
+#include <velk/inline_any.h>
 #include <velk/interface/intf_future.h>
 #include <velk/interface/intf_log.h>
 #include <velk/interface/intf_object.h>
@@ -9,6 +11,7 @@
 #include <velk/interface/intf_property.h>
 #include <velk/interface/intf_type_registry.h>
 #include <velk/interface/types.h>
+#include <velk/small_vector.h>
 #include <velk/vector.h>
 #include <velk/velk_export.h>
 
@@ -16,15 +19,39 @@ namespace velk {
 
 class IObjectStorage;
 
-/** @brief Owns cloned function args and lazily builds the raw pointer array for FnArgs. */
+namespace detail {
+
+/**
+ * @brief Returns the factory that the velk DLL itself registers for the built-in value type @p type.
+ *
+ * Returns nullptr for types that are not built in (for example types registered by plugins).
+ * The returned factory lives as long as the velk DLL.
+ */
+VELK_EXPORT const IObjectFactory* find_builtin_any_factory(Uid type);
+
+} // namespace detail
+
+/**
+ * @brief Owns copies of function args and lazily builds the raw pointer array for FnArgs.
+ *
+ * Trivially copyable args of built-in types are copied inline; others are deep-cloned to
+ * the heap, so that their factory (which may belong to an unloadable plugin) stays alive
+ * with the copy. Inline copies are not reference counted: a deferred handler that needs
+ * an argument after it returns must take an owned copy with clone() rather than wrap the
+ * IAny* in a shared_ptr (get_self() returns null for them). Inline copies report the
+ * class UID of the AnyValue they were copied from.
+ */
 struct DeferredArgs : public ::velk::NoCopyMove
 {
-    /** @brief Deep-clones each argument from @p args. */
+    /** @brief Copies each argument from @p args. */
     explicit DeferredArgs(FnArgs args)
     {
         owned_.reserve(args.count);
         for (auto* arg : args) {
-            owned_.push_back(arg ? arg->clone() : nullptr);
+            auto& copy = owned_.emplace_back();
+            if (arg) {
+                assign(copy, *arg);
+            }
         }
     }
 
@@ -34,15 +61,30 @@ struct DeferredArgs : public ::velk::NoCopyMove
         if (owned_.size() && ptrs_.size() != owned_.size()) {
             ptrs_.resize(owned_.size());
             for (size_t i = 0; i < owned_.size(); ++i) {
-                ptrs_[i] = owned_[i].get();
+                ptrs_[i] = owned_[i].empty() ? nullptr : &owned_[i];
             }
         }
         return {ptrs_.data(), ptrs_.size()};
     }
 
 private:
-    vector<IAny::Ptr> owned_;
-    mutable vector<const IAny*> ptrs_;
+    static void assign(InlineAny<>& copy, const IAny& arg)
+    {
+        if (copy.assign(arg) && copy.is_inline()) {
+            if (auto* factory = detail::find_builtin_any_factory(copy.get_compatible_types()[0])) {
+                copy.set_factory(factory);
+                return;
+            }
+            copy.assign_clone(arg);
+        }
+    }
+
+    /// Deferred invocations nearly always carry one argument (on_changed, future results).
+    /// Each InlineAny is about 100 bytes, so larger argument lists go to the Deferred slot.
+    static constexpr size_t inline_args = 1;
+
+    small_vector<InlineAny<>, inline_args> owned_;
+    mutable small_vector<const IAny*, inline_args> ptrs_;
 };
 
 /** @brief Deferred task */
@@ -134,6 +176,16 @@ public:
     /** @brief Creates an owned-callback IFunction from a context, trampoline, and deleter. */
     virtual IFunction::Ptr create_owned_callback(void* context, IFunction::BoundFn* fn,
                                                  IFunction::ContextDeleter* deleter) const = 0;
+    /**
+     * @brief Routes the allocations of @p slot through @p allocator (nullptr restores the fallback).
+     *
+     * Fails if memory allocated through the slot is still outstanding. In practice the Hive
+     * and Deferred slots can be switched while idle, whereas the Default slot must be installed
+     * through detail::install_allocator() before the first call to ::velk::instance().
+     */
+    virtual ReturnValue set_allocator(AllocatorSlot slot, IAllocator* allocator) = 0;
+    /** @brief Returns the allocation counters of @p slot. */
+    virtual AllocatorStats get_allocator_stats(AllocatorSlot slot) const = 0;
     /**
      * @brief Creates a property for type T with an optional initial value.
      * @tparam T The value type for the property.
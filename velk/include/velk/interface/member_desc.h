@@ -5,6 +5,7 @@
 #include <velk/api/traits.h>
 #include <velk/array_view.h>
 #include <velk/common.h>
+#include <velk/interned_string.h>
 #include <velk/interface/intf_interface.h>
 
 #include <cstdint>
@@ -40,6 +41,8 @@ struct PropertyKind
     /** @brief Creates an AnyRef pointing into the State struct at @p stateBase. */
     IAny::Ptr (*createRef)(void* stateBase) = nullptr;
     uint32_t flags{ObjectFlags::None}; ///< ObjectFlags to apply to the created PropertyImpl.
+    /** @brief Returns the byte offset of the value within its State struct (used for bulk access). */
+    size_t (*getOffset)() = nullptr;
 };
 
 /** @brief Kind-specific data for ArrayProperty members.
@@ -74,6 +77,7 @@ struct MemberDesc
     MemberKind kind;                    ///< Discriminator (Property, Event, or Function).
     const InterfaceInfo* interfaceInfo; ///< Interface that declared this member.
     const void* ext = nullptr;          ///< Points to PropertyKind or FunctionKind based on @c kind.
+    uint64_t nameHash = hash_string(name); ///< hash_string(name), computed at compile time for static metadata.
 
     /// Typed ext member getter for MemberDesc.kind = MemberKind::Property
     constexpr const PropertyKind* propertyKind() const
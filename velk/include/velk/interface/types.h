@@ -66,6 +66,14 @@ namespace ObjectFlags {
 inline constexpr uint32_t None = 0;
 inline constexpr uint32_t ReadOnly = 1 << 0;    ///< Property rejects writes via set_value/set_data.
 inline constexpr uint32_t HiveManaged = 1 << 1; ///< Object is managed by a Hive.
+/**
+ * @brief Object never leaves its creating thread; its reference counts use non-atomic updates.
+ *
+ * Honored by heap-created objects (IVelk::create, IObjectFactory::create_instance).
+ * Call share() on the object's shared_ptr to promote it to atomic counting before
+ * handing it to another thread. Debug builds assert on access from other threads.
+ */
+inline constexpr uint32_t ThreadConfined = 1 << 2;
 } // namespace ObjectFlags
 
 /** @brief Controls whether metadata lookups create instances on miss. */
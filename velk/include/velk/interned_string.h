@@ -0,0 +1,100 @@
+#ifndef VELK_INTERNED_STRING_H
+#define VELK_INTERNED_STRING_H
+
+#include <velk/string_view.h>
+#include <velk/velk_export.h>
+
+#include <cstdint>
+
+namespace velk {
+
+/** @brief Returns the 64-bit FNV-1a hash of @p str. Usable in constant expressions. */
+constexpr uint64_t hash_string(string_view str)
+{
+    uint64_t h = 14695981039346656037ull;
+    for (char c : str) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+namespace detail {
+
+/** @brief Storage of one interned string. Immutable, and never freed once created. */
+struct interned_entry
+{
+    uint64_t hash; ///< hash_string() of the characters.
+    size_t size;   ///< Number of characters, excluding the null terminator.
+    char data[1];  ///< Null-terminated characters (allocated to size + 1).
+};
+
+/**
+ * @brief Returns the unique entry for @p str, adding it to the global string table if needed.
+ *
+ * Thread-safe. Implemented in the velk DLL so that all modules share one table.
+ * Returns nullptr for an empty string.
+ */
+VELK_EXPORT const interned_entry* intern(string_view str);
+
+} // namespace detail
+
+/**
+ * @brief Handle to a string stored once in a global, thread-safe string table.
+ *
+ * Interning the same characters always yields the same handle, so equality is a
+ * pointer comparison and the hash is precomputed. The handle is a single pointer
+ * and trivially copyable, which makes it cheap to store in properties
+ * (Property<interned_string>) for enum-like tags repeated across many objects.
+ *
+ * Constructing an interned_string takes a lock on the string table; construct
+ * handles for frequently used strings once and reuse them. Interned strings are
+ * never freed.
+ */
+class interned_string
+{
+public:
+    /** @brief Constructs the empty string. */
+    constexpr interned_string() = default;
+
+    /** @brief Interns @p str. */
+    explicit interned_string(string_view str) : entry_(detail::intern(str)) {}
+
+    /** @brief Returns the characters as a string_view. */
+    string_view view() const { return entry_ ? string_view(entry_->data, entry_->size) : string_view(); }
+    /** @brief Implicit conversion to string_view. */
+    operator string_view() const { return view(); }
+    /** @brief Returns a null-terminated C string. */
+    const char* c_str() const { return entry_ ? entry_->data : ""; }
+    /** @brief Returns the number of characters. */
+    size_t size() const { return entry_ ? entry_->size : 0; }
+    /** @brief Returns true if the string is empty. */
+    bool empty() const { return !entry_; }
+    /** @brief Returns the precomputed hash_string() of the characters. */
+    uint64_t hash() const { return entry_ ? entry_->hash : hash_string({}); }
+
+    /** @brief Equality comparison (pointer compare). */
+    bool operator==(const interned_string& o) const { return entry_ == o.entry_; }
+    /** @brief Inequality comparison (pointer compare). */
+    bool operator!=(const interned_string& o) const { return entry_ != o.entry_; }
+    /** @brief Equality comparison with a string_view (character compare). */
+    bool operator==(string_view sv) const { return view() == sv; }
+    /** @brief Inequality comparison with a string_view (character compare). */
+    bool operator!=(string_view sv) const { return view() != sv; }
+
+    /** @brief Stream output support. */
+    template <class OStream>
+    friend OStream& operator<<(OStream& os, const interned_string& s)
+    {
+        return os << s.view();
+    }
+
+private:
+    const detail::interned_entry* entry_{};
+};
+
+static_assert(sizeof(interned_string) == sizeof(void*), "velk::interned_string must be pointer-sized");
+
+} // namespace velk
+
+#endif // VELK_INTERNED_STRING_H
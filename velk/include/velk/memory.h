@@ -1,6 +1,7 @@
 #ifndef VELK_MEMORY_H
 #define VELK_MEMORY_H
 
+#include <velk/relocatable.h>
 #include <velk/velk_export.h>
 
 #include <atomic>
@@ -12,6 +13,20 @@
 
 namespace velk {
 
+struct control_block;
+
+namespace detail {
+
+/**
+ * @brief Returns false if @p block was recorded as owned by another thread.
+ *
+ * Debug builds record the owning thread of thread-confined blocks with set_local_owner()
+ * and check it on every count update of a local block. Blocks without a record pass.
+ */
+VELK_EXPORT bool is_local_owner(const control_block* block);
+
+} // namespace detail
+
 /**
  * @brief Shared control block for shared_ptr/weak_ptr (16 bytes).
  *
@@ -27,6 +42,12 @@ namespace velk {
  * reference. Each weak_ptr adds +1 on construction and -1 on destruction.
  * When the last strong ref drops, the strong group's +1 is released. The
  * block is deleted when weak reaches zero.
+ *
+ * @par Thread-confined blocks
+ * When the local tag is set (see ObjectFlags::ThreadConfined), the counts are
+ * updated with plain relaxed load/store pairs instead of atomic read-modify-write
+ * operations. Such a block must only be touched by its owning thread until it is
+ * promoted with share().
  */
 struct control_block
 {
@@ -34,22 +55,38 @@ struct control_block
     ///  bit 0 (external): block is an external_control_block with a destroy function pointer.
     ///  bit 1 (embedded): block lives inside a larger allocation (e.g. a hive page) and must
     ///                     not be individually deleted or returned to the pool.
+    ///  bit 2 (local):    counts are owned by a single thread and updated without atomic RMW.
     static constexpr uintptr_t tag_external = 1;
     static constexpr uintptr_t tag_embedded = 2;
-    static constexpr uintptr_t tag_mask = tag_external | tag_embedded;
+    static constexpr uintptr_t tag_local = 4;
+    static constexpr uintptr_t tag_mask = tag_external | tag_embedded | tag_local;
 
     std::atomic<int32_t> strong{0};
     std::atomic<int32_t> weak{1}; ///< 1 = "strong group exists"
 
-    /** @brief Increments the strong count (relaxed). */
-    void add_ref() { strong.fetch_add(1, std::memory_order_relaxed); }
+    /** @brief Increments the strong count (relaxed, non-atomic for local blocks). */
+    void add_ref()
+    {
+        if (is_local()) {
+            assert(detail::is_local_owner(this) && "control_block: thread-confined object used off-thread");
+            strong.store(strong.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            strong.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
 
     /**
-     * @brief Decrements the strong count (acq_rel).
+     * @brief Decrements the strong count (acq_rel, non-atomic for local blocks).
      * @return true if this was the last strong ref.
      */
     bool release_ref()
     {
+        if (is_local()) {
+            assert(detail::is_local_owner(this) && "control_block: thread-confined object used off-thread");
+            auto old = strong.load(std::memory_order_relaxed);
+            strong.store(old - 1, std::memory_order_relaxed);
+            return old == 1;
+        }
         if (strong.fetch_sub(1, std::memory_order_acq_rel) == 1) {
             return true;
         }
@@ -67,6 +104,14 @@ struct control_block
     bool try_add_ref()
     {
         int32_t old = strong.load(std::memory_order_relaxed);
+        if (is_local()) {
+            assert(detail::is_local_owner(this) && "control_block: thread-confined object used off-thread");
+            if (old > 0) {
+                strong.store(old + 1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
         while (old > 0) {
             if (strong.compare_exchange_weak(
                     old, old + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
@@ -105,17 +150,55 @@ struct control_block
     /** @brief Returns true if the embedded tag is set. */
     bool is_embedded() const { return reinterpret_cast<uintptr_t>(ptr_) & tag_embedded; }
 
-    /** @brief Increments the weak count (relaxed). */
-    void add_weak() { weak.fetch_add(1, std::memory_order_relaxed); }
+    /** @brief Sets the local tag, switching the counts to non-atomic updates. Preserves other tags. */
+    void set_local_tag()
+    {
+        ptr_ = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr_) | tag_local);
+    }
+
+    /**
+     * @brief Clears the local tag, switching the counts back to atomic updates.
+     *
+     * Must be called on the owning thread, before the block becomes reachable
+     * from any other thread.
+     */
+    void clear_local_tag()
+    {
+        ptr_ = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr_) & ~tag_local);
+    }
+
+    /** @brief Returns true if the local (thread-confined) tag is set. */
+    bool is_local() const { return reinterpret_cast<uintptr_t>(ptr_) & tag_local; }
+
+    /** @brief Increments the weak count (relaxed, non-atomic for local blocks). */
+    void add_weak()
+    {
+        if (is_local()) {
+            assert(detail::is_local_owner(this) && "control_block: thread-confined object used off-thread");
+            weak.store(weak.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            weak.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
 
     /**
-     * @brief Decrements the weak count (acq_rel).
+     * @brief Decrements the weak count (acq_rel, non-atomic for local blocks).
      * @return true if this was the last weak ref (caller must deallocate the block).
      */
-    bool release_weak() { return weak.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+    bool release_weak()
+    {
+        if (is_local()) {
+            assert(detail::is_local_owner(this) && "control_block: thread-confined object used off-thread");
+            auto old = weak.load(std::memory_order_relaxed);
+            weak.store(old - 1, std::memory_order_relaxed);
+            return old == 1;
+        }
+        return weak.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
 
 private:
-    void* ptr_{nullptr}; ///< Tagged pointer: bit 0 = external, bit 1 = embedded, bits 2+ = object address.
+    void* ptr_{nullptr}; ///< Tagged pointer: bit 0 = external, bit 1 = embedded, bit 2 = local,
+                         ///< bits 3+ = object address.
 };
 
 /**
@@ -155,6 +238,36 @@ VELK_EXPORT control_block* alloc_control_block(bool external = false);
  */
 VELK_EXPORT void dealloc_control_block(control_block* block, bool external = false);
 
+/** @brief Counters for the calling thread's control_block pool (see get_block_pool_stats()). */
+struct block_pool_stats
+{
+    uint64_t allocs;  ///< Number of alloc_control_block() calls on this thread.
+    uint64_t hits;    ///< Allocations served from the pool (including blocks refilled from the depot).
+    uint64_t refills; ///< Magazines taken from the global depot when the thread pool ran dry.
+    uint64_t flushes; ///< Magazines handed to the global depot when the thread pool was full.
+};
+
+/**
+ * @brief Returns the control_block pool counters of the calling thread.
+ *
+ * All counters are zero when pooling is disabled (VELK_ENABLE_BLOCK_POOL=OFF).
+ */
+VELK_EXPORT block_pool_stats get_block_pool_stats();
+
+/**
+ * @brief Returns a small non-zero identifier for the calling thread.
+ *
+ * Used to record and verify the owning thread of thread-confined objects in
+ * debug builds. Implemented in velk.cpp so that all modules agree on the value.
+ */
+VELK_EXPORT uint32_t current_thread_tag();
+
+/**
+ * @brief Records @p tag as the owning thread of the thread-confined @p block, or forgets the
+ *        record if @p tag is 0. See is_local_owner().
+ */
+VELK_EXPORT void set_local_owner(const control_block* block, uint32_t tag);
+
 /**
  * @brief Releases the "strong group" weak ref, freeing the block if no weak_ptrs remain.
  *
@@ -590,6 +703,37 @@ public:
     bool expired() const { return !block_ || block_->strong.load(std::memory_order_acquire) == 0; }
 };
 
+/** @brief shared_ptr is a {T*, control_block*} pair, relocatable with memcpy. */
+template <class T>
+struct is_trivially_relocatable<shared_ptr<T>> : std::true_type
+{};
+
+/** @brief weak_ptr is a {T*, control_block*} pair, relocatable with memcpy. */
+template <class T>
+struct is_trivially_relocatable<weak_ptr<T>> : std::true_type
+{};
+
+/**
+ * @brief Promotes a thread-confined object to atomic reference counting.
+ *
+ * Clears the local tag on the control block shared by @p p, after which the
+ * object may be handed to other threads. Must be called on the owning thread
+ * before the object (or any pointer to it) is published to another thread.
+ * No-op for objects that are not thread-confined.
+ *
+ * @param p Any shared_ptr to the object.
+ */
+template <class T>
+void share(const shared_ptr<T>& p)
+{
+    if (auto* block = p.block()) {
+        block->clear_local_tag();
+#ifndef NDEBUG
+        detail::set_local_owner(block, 0);
+#endif
+    }
+}
+
 /**
  * @brief Creates a shared_ptr managing a newly constructed T.
  * @tparam T The type to construct.
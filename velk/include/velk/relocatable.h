@@ -0,0 +1,38 @@
+#ifndef VELK_RELOCATABLE_H
+#define VELK_RELOCATABLE_H
+
+#include <type_traits>
+#include <utility>
+
+namespace velk {
+
+/**
+ * @brief True if a T can be relocated by copying its bytes.
+ *
+ * Relocation moves an object to a new address and abandons the source without running its
+ * destructor. For a trivially relocatable type this is equivalent to memcpy (or realloc),
+ * which velk::vector uses for growth, insert and erase.
+ *
+ * Holds for trivially copyable types. Velk's own smart pointers, strings and vectors
+ * specialize it: they only hold pointers to memory outside the object. Specialize it for
+ * other types only if they have no pointers into themselves and are not tracked by address.
+ *
+ * @tparam T The type to query.
+ */
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T>
+{};
+
+/** @brief A pair is trivially relocatable if both of its members are. */
+template <class A, class B>
+struct is_trivially_relocatable<std::pair<A, B>>
+    : std::bool_constant<is_trivially_relocatable<A>::value && is_trivially_relocatable<B>::value>
+{};
+
+/** @brief Shorthand for is_trivially_relocatable<T>::value. */
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+} // namespace velk
+
+#endif // VELK_RELOCATABLE_H
@@ -0,0 +1,385 @@
+#ifndef VELK_SMALL_VECTOR_H
+#define VELK_SMALL_VECTOR_H
+
+#include <velk/allocator.h>
+#include <velk/array_view.h>
+
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace velk {
+
+/**
+ * @brief ABI-stable resizable array with inline storage for the first @p N elements.
+ *
+ * Behaves like velk::vector, but holds up to @p N elements in an inline buffer and only
+ * allocates once the size exceeds it. Intended for containers that almost always hold a
+ * handful of elements (event handlers, child lists, argument packs).
+ *
+ * Heap buffers are allocated through the velk allocator (see allocator.h) from @p Slot.
+ * Once spilled to the heap, the buffer is kept until the small_vector is destroyed or
+ * shrink_to_fit() moves the elements back inline.
+ *
+ * Moving a small_vector whose elements are inline moves the elements one by one, so
+ * pointers into the source are not preserved (unlike velk::vector).
+ *
+ * @tparam T    The element type.
+ * @tparam N    Number of elements stored inline.
+ * @tparam Slot The allocator slot used for heap buffers.
+ */
+template <class T, size_t N, AllocatorSlot Slot = AllocatorSlot::Default>
+class small_vector
+{
+    static_assert(N > 0, "small_vector requires inline capacity");
+    static constexpr bool trivial = std::is_trivially_copyable_v<T>;
+
+public:
+    using value_type = T; ///< The element type.
+
+    /** @brief Number of elements stored inline. */
+    static constexpr size_t inline_capacity = N;
+
+    /** @brief Default-constructs an empty small_vector using the inline buffer. */
+    small_vector() noexcept = default;
+
+    /** @brief Constructs a small_vector from a pointer range [@p first, @p last). */
+    small_vector(const T* first, const T* last)
+    {
+        assert(last >= first);
+        size_t count = static_cast<size_t>(last - first);
+        ensure_capacity(count);
+        copy_construct(data_, first, count);
+        size_ = count;
+    }
+
+    /** @brief Constructs a small_vector from an initializer list. */
+    small_vector(std::initializer_list<T> init) : small_vector(init.begin(), init.end()) {}
+
+    /** @brief Constructs a small_vector by copying elements from an array_view. */
+    small_vector(array_view<T> view) : small_vector(view.begin(), view.end()) {}
+
+    /** @brief Copy constructor. */
+    small_vector(const small_vector& other) : small_vector(other.begin(), other.end()) {}
+
+    /** @brief Move constructor. Steals a heap buffer, or moves inline elements. */
+    small_vector(small_vector&& other) noexcept { take(other); }
+
+    /** @brief Copy assignment. */
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other) {
+            clear();
+            ensure_capacity(other.size_);
+            copy_construct(data_, other.data_, other.size_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    /** @brief Move assignment. */
+    small_vector& operator=(small_vector&& other) noexcept
+    {
+        if (this != &other) {
+            clear();
+            release_heap();
+            take(other);
+        }
+        return *this;
+    }
+
+    /** @brief Destructor. Destroys all elements and frees a heap buffer. */
+    ~small_vector()
+    {
+        destroy_range(data_, size_);
+        release_heap();
+    }
+
+    /** @brief Returns a reference to the element at index @p i (unchecked). */
+    T& operator[](size_t i) { return data_[i]; }
+    /** @brief Returns a const reference to the element at index @p i (unchecked). */
+    const T& operator[](size_t i) const { return data_[i]; }
+
+    /** @brief Returns a reference to the first element. */
+    T& front() { return data_[0]; }
+    /** @brief Returns a const reference to the first element. */
+    const T& front() const { return data_[0]; }
+    /** @brief Returns a reference to the last element. */
+    T& back() { return data_[size_ - 1]; }
+    /** @brief Returns a const reference to the last element. */
+    const T& back() const { return data_[size_ - 1]; }
+
+    /** @brief Returns a pointer to the underlying data. */
+    T* data() { return data_; }
+    /** @brief Returns a const pointer to the underlying data. */
+    const T* data() const { return data_; }
+
+    /** @brief Returns an iterator to the first element. */
+    T* begin() { return data_; }
+    /** @brief Returns a const iterator to the first element. */
+    const T* begin() const { return data_; }
+    /** @brief Returns a past-the-end iterator. */
+    T* end() { return data_ + size_; }
+    /** @brief Returns a const past-the-end iterator. */
+    const T* end() const { return data_ + size_; }
+
+    /** @brief Returns true if the small_vector contains no elements. */
+    bool empty() const { return size_ == 0; }
+    /** @brief Returns the number of elements. */
+    size_t size() const { return size_; }
+    /** @brief Returns the number of elements that can be held without reallocation. */
+    size_t capacity() const { return capacity_; }
+    /** @brief Returns true if the elements are stored in the inline buffer. */
+    bool is_inline() const { return data_ == inline_data(); }
+
+    /** @brief Reserves storage for at least @p new_cap elements. */
+    void reserve(size_t new_cap) { ensure_capacity(new_cap); }
+
+    /** @brief Moves the elements back inline if they fit, otherwise reduces the heap buffer to size. */
+    void shrink_to_fit()
+    {
+        if (is_inline() || capacity_ == size_) {
+            return;
+        }
+        relocate_to(size_ <= N ? inline_data() : alloc_buffer(size_), size_ <= N ? N : size_);
+    }
+
+    /** @brief Destroys all elements. Capacity is unchanged. */
+    void clear()
+    {
+        destroy_range(data_, size_);
+        size_ = 0;
+    }
+
+    /** @brief Appends a copy of @p value. Safe when @p value references this small_vector. */
+    void push_back(const T& value) { emplace_back(value); }
+
+    /** @brief Appends @p value by move. */
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    /** @brief Constructs an element in-place at the end. */
+    template <class... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (size_ == capacity_) {
+            // Arguments may reference an element that is about to be relocated
+            T tmp(std::forward<Args>(args)...);
+            ensure_capacity(size_ + 1);
+            new (data_ + size_) T(std::move(tmp));
+        } else {
+            new (data_ + size_) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    /** @brief Removes the last element. */
+    void pop_back()
+    {
+        assert(size_ > 0);
+        --size_;
+        data_[size_].~T();
+    }
+
+    /**
+     * @brief Inserts @p value before the element at @p pos.
+     * @return Pointer to the inserted element.
+     */
+    T* insert(const T* pos, T value)
+    {
+        size_t idx = static_cast<size_t>(pos - data_);
+        assert(idx <= size_);
+        ensure_capacity(size_ + 1);
+        if constexpr (trivial) {
+            std::memmove(data_ + idx + 1, data_ + idx, (size_ - idx) * sizeof(T));
+            new (data_ + idx) T(std::move(value));
+        } else if (idx < size_) {
+            new (data_ + size_) T(std::move(data_[size_ - 1]));
+            for (size_t i = size_ - 1; i > idx; --i) {
+                data_[i] = std::move(data_[i - 1]);
+            }
+            data_[idx] = std::move(value);
+        } else {
+            new (data_ + idx) T(std::move(value));
+        }
+        ++size_;
+        return data_ + idx;
+    }
+
+    /**
+     * @brief Erases the element at @p pos.
+     * @return Pointer to the element following the removed one.
+     */
+    T* erase(const T* pos) { return erase(pos, pos + 1); }
+
+    /**
+     * @brief Erases elements in the range [@p first, @p last).
+     * @return Pointer to the element following the last removed one.
+     */
+    T* erase(const T* first, const T* last)
+    {
+        size_t idx = static_cast<size_t>(first - data_);
+        size_t end_idx = static_cast<size_t>(last - data_);
+        assert(idx <= end_idx && end_idx <= size_);
+        size_t count = end_idx - idx;
+        if (count == 0) {
+            return data_ + idx;
+        }
+        if constexpr (trivial) {
+            std::memmove(data_ + idx, data_ + end_idx, (size_ - end_idx) * sizeof(T));
+        } else {
+            for (size_t i = idx; i + count < size_; ++i) {
+                data_[i] = std::move(data_[i + count]);
+            }
+            destroy_range(data_ + size_ - count, count);
+        }
+        size_ -= count;
+        return data_ + idx;
+    }
+
+    /** @brief Resizes to @p count elements, value-initializing new ones. */
+    void resize(size_t count)
+    {
+        if (count < size_) {
+            destroy_range(data_ + count, size_ - count);
+        } else if (count > size_) {
+            ensure_capacity(count);
+            for (size_t i = size_; i < count; ++i) {
+                new (data_ + i) T();
+            }
+        }
+        size_ = count;
+    }
+
+    /** @brief Swaps the contents of this small_vector with @p other. */
+    void swap(small_vector& other) noexcept
+    {
+        small_vector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    /** @brief Implicit conversion to a read-only array_view. */
+    operator array_view<T>() const { return {data_, size_}; }
+
+    /** @brief Equality comparison (element-wise). */
+    bool operator==(const small_vector& other) const
+    {
+        if (size_ != other.size_) {
+            return false;
+        }
+        for (size_t i = 0; i < size_; ++i) {
+            if (!(data_[i] == other.data_[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** @brief Inequality comparison. */
+    bool operator!=(const small_vector& other) const { return !(*this == other); }
+
+private:
+    T* inline_data() { return reinterpret_cast<T*>(storage_); }
+    const T* inline_data() const { return reinterpret_cast<const T*>(storage_); }
+
+    /** @brief Allocates a heap buffer for @p count elements. Aborts on failure. */
+    static T* alloc_buffer(size_t count)
+    {
+        void* p = detail::allocate(count * sizeof(T), alignof(T), Slot);
+        assert(p && "velk::small_vector allocation failed");
+        return static_cast<T*>(p);
+    }
+
+    /** @brief Frees the heap buffer, if any, and points back at the inline buffer. Does not destroy elements. */
+    void release_heap() noexcept
+    {
+        if (!is_inline()) {
+            detail::deallocate(data_, capacity_ * sizeof(T), alignof(T), Slot);
+            data_ = inline_data();
+            capacity_ = N;
+        }
+    }
+
+    static void copy_construct(T* dst, const T* src, size_t count)
+    {
+        if constexpr (trivial) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(dst), src, count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                new (dst + i) T(src[i]);
+            }
+        }
+    }
+
+    /** @brief Move-constructs @p count elements from @p src into @p dst and destroys the sources. */
+    static void move_construct(T* dst, T* src, size_t count)
+    {
+        if constexpr (trivial) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(dst), src, count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                new (dst + i) T(std::move(src[i]));
+                src[i].~T();
+            }
+        }
+    }
+
+    static void destroy_range(T* first, size_t count)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; ++i) {
+                first[i].~T();
+            }
+        }
+    }
+
+    /** @brief Moves the elements into @p buf (capacity @p cap) and frees the previous heap buffer. */
+    void relocate_to(T* buf, size_t cap)
+    {
+        move_construct(buf, data_, size_);
+        if (!is_inline()) {
+            detail::deallocate(data_, capacity_ * sizeof(T), alignof(T), Slot);
+        }
+        data_ = buf;
+        capacity_ = cap;
+    }
+
+    /** @brief Ensures capacity for at least @p required elements, spilling to the heap if needed. */
+    void ensure_capacity(size_t required)
+    {
+        if (required > capacity_) {
+            size_t cap = capacity_ * 2;
+            relocate_to(alloc_buffer(cap < required ? required : cap), cap < required ? required : cap);
+        }
+    }
+
+    /** @brief Takes the contents of @p other (which must not own elements of this). Leaves @p other empty. */
+    void take(small_vector& other) noexcept
+    {
+        if (other.is_inline()) {
+            move_construct(data_, other.data_, other.size_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    T* data_{inline_data()};
+    size_t size_{};
+    size_t capacity_{N};
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+} // namespace velk
+
+#endif // VELK_SMALL_VECTOR_H
@@ -1,11 +1,12 @@
 #ifndef VELK_STRING_H
 #define VELK_STRING_H
 
+#include <velk/allocator.h>
+#include <velk/relocatable.h>
 #include <velk/string_view.h>
 #include <velk/uid.h>
 
 #include <cassert>
-#include <cstdlib>
 #include <cstring>
 
 namespace velk {
@@ -14,8 +15,8 @@ namespace velk {
  * @brief ABI-stable owning string with small-string optimization.
  *
  * Replacement for std::string in public interface headers.
- * Uses malloc/free for heap buffer management, making it safe across
- * DLL boundaries. Always null-terminated.
+ * Allocates heap buffers through the velk allocator (AllocatorSlot::Default),
+ * which lives in the velk DLL, making it safe across DLL boundaries. Always null-terminated.
  *
  * Strings of up to 22 characters are stored inline (no heap allocation).
  * The last byte of the 24-byte layout discriminates between modes:
@@ -101,7 +102,7 @@ public:
     {
         if (this != &other) {
             if (is_heap()) {
-                std::free(heap_.ptr_);
+                free_heap_buffer();
             }
             std::memcpy(raw_bytes(), other.raw_bytes(), sizeof(*this));
             std::memset(other.raw_bytes(), 0, sizeof(other));
@@ -129,7 +130,7 @@ public:
     ~string()
     {
         if (is_heap()) {
-            std::free(heap_.ptr_);
+            free_heap_buffer();
         }
     }
 
@@ -196,13 +197,14 @@ public:
         if (s <= sso_capacity) {
             // Transition back to inline.
             char* old_ptr = heap_.ptr_;
+            size_t old_cap = heap_.capacity_ & ~heap_flag;
             std::memset(raw_bytes(), 0, sizeof(*this));
             if (s > 0) {
                 std::memcpy(local_.buf_, old_ptr, s);
             }
             local_.buf_[s] = '\0';
             local_.size_ = static_cast<unsigned char>(s);
-            std::free(old_ptr);
+            free_buffer(old_ptr, old_cap + 1);
         } else {
             size_t real_cap = heap_.capacity_ & ~heap_flag;
             if (real_cap == s) {
@@ -210,7 +212,7 @@ public:
             }
             char* new_buf = alloc_buffer(s + 1);
             std::memcpy(new_buf, heap_.ptr_, s + 1);
-            std::free(heap_.ptr_);
+            free_heap_buffer();
             set_heap(new_buf, s, s);
         }
     }
@@ -471,14 +473,20 @@ private:
         }
     }
 
-    /** @brief Allocates a raw buffer of @p bytes. Aborts on failure. */
+    /** @brief Allocates a raw buffer of @p bytes from the Default allocator slot. Aborts on failure. */
     static char* alloc_buffer(size_t bytes)
     {
-        void* p = std::malloc(bytes);
+        void* p = detail::allocate(bytes);
         assert(p && "velk::string allocation failed");
         return static_cast<char*>(p);
     }
 
+    /** @brief Returns a buffer of @p bytes obtained from alloc_buffer(). */
+    static void free_buffer(char* p, size_t bytes) noexcept { detail::deallocate(p, bytes); }
+
+    /** @brief Frees the current heap buffer (capacity + null terminator). Heap mode only. */
+    void free_heap_buffer() noexcept { free_buffer(heap_.ptr_, (heap_.capacity_ & ~heap_flag) + 1); }
+
     /**
      * @brief Grows the buffer to hold at least @p required characters (plus null).
      *
@@ -491,14 +499,15 @@ private:
         while (new_cap < required) {
             new_cap *= 2;
         }
-        char* new_buf = alloc_buffer(new_cap + 1);
         size_t s = size();
+        const char* old_data = data();
+        char* new_buf = alloc_buffer(new_cap + 1);
         if (s > 0) {
-            std::memcpy(new_buf, data(), s);
+            std::memcpy(new_buf, old_data, s);
         }
         new_buf[s] = '\0';
         if (is_heap()) {
-            std::free(heap_.ptr_);
+            free_heap_buffer();
         }
         set_heap(new_buf, s, new_cap);
     }
@@ -529,6 +538,11 @@ private:
 
 static_assert(sizeof(string) == 3 * sizeof(void*), "velk::string must be 24 bytes");
 
+/** @brief velk::string holds either inline characters or a heap pointer, never a pointer into itself. */
+template <>
+struct is_trivially_relocatable<string> : std::true_type
+{};
+
 /** @brief Returns the UUID as a string (xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx). */
 inline string to_string(Uid uid)
 {
@@ -0,0 +1,76 @@
+#ifndef VELK_TYPE_INDEX_H
+#define VELK_TYPE_INDEX_H
+
+#include <velk/common.h>
+#include <velk/ext/member_traits.h>
+#include <velk/velk_export.h>
+
+#include <cstdint>
+
+namespace velk {
+
+/**
+ * @brief Dense runtime index of a type UID.
+ *
+ * Indices are assigned in the order UIDs are first seen, starting from 0 (which is always
+ * Uid{}, the IInterface UID), and are never reused. They are process-wide (all modules share
+ * the table in the velk DLL) but not stable across runs, so they must not be persisted.
+ * Use them to replace 128-bit Uid compares and sorted-array searches with a single-word
+ * compare or direct array indexing.
+ */
+using TypeIndex = uint32_t;
+
+/** @brief TypeIndex value returned for UIDs that have not been assigned an index. */
+inline constexpr TypeIndex invalid_type_index = ~TypeIndex(0);
+
+namespace detail {
+
+/**
+ * @brief Returns the index of @p uid, assigning the next free index if it has none yet.
+ *
+ * Thread-safe. Takes a lock only when a new index is assigned.
+ */
+VELK_EXPORT TypeIndex type_index(Uid uid);
+
+/**
+ * @brief Returns the index of @p uid, or invalid_type_index if none has been assigned.
+ *
+ * Thread-safe and lock-free; never assigns an index.
+ */
+VELK_EXPORT TypeIndex find_type_index(Uid uid);
+
+/** @brief Returns the UID that @p index was assigned to, or Uid{} if @p index is out of range. */
+VELK_EXPORT Uid type_index_uid(TypeIndex index);
+
+/** @brief Returns T::class_id() for classes, T::UID for interfaces and type_uid<T>() otherwise. */
+template <class T>
+constexpr Uid index_uid()
+{
+    // Classes inherit UID from their interfaces, so class_id() takes precedence
+    if constexpr (has_class_id<T>::value) {
+        return T::class_id();
+    } else if constexpr (has_static_uid<T>::value) {
+        return T::UID;
+    } else {
+        return type_uid<T>();
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Returns the TypeIndex of @p T.
+ *
+ * The UID is T::class_id() for object classes, T::UID for interfaces and type_uid<T>() for
+ * value types. The index is looked up once per module and cached in a function-local static.
+ */
+template <class T>
+TypeIndex type_index()
+{
+    static const TypeIndex index = detail::type_index(detail::index_uid<T>());
+    return index;
+}
+
+} // namespace velk
+
+#endif // VELK_TYPE_INDEX_H
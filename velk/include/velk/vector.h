@@ -1,10 +1,11 @@
 #ifndef VELK_VECTOR_H
 #define VELK_VECTOR_H
 
+#include <velk/allocator.h>
 #include <velk/array_view.h>
+#include <velk/relocatable.h>
 
 #include <cassert>
-#include <cstdlib>
 #include <cstring>
 #include <initializer_list>
 #include <type_traits>
@@ -27,18 +28,29 @@ class vector_base
 protected:
     vector_base() = default;
 
-    /** @brief Allocates a raw buffer of @p bytes. Aborts on failure. */
+    /** @brief Allocates a raw buffer of @p bytes from the Default allocator slot. Aborts on failure. */
     static void* alloc_raw(size_t bytes)
     {
-        void* p = std::malloc(bytes);
+        void* p = detail::allocate(bytes);
         assert(p && "velk::vector allocation failed");
         return p;
     }
 
+    /** @brief Returns a raw buffer of @p bytes obtained from alloc_raw(). */
+    static void dealloc_raw(void* p, size_t bytes) noexcept { detail::deallocate(p, bytes); }
+
+    /** @brief Resizes a raw buffer from alloc_raw() to @p new_bytes, keeping its bytes. Aborts on failure. */
+    static void* realloc_raw(void* p, size_t old_bytes, size_t new_bytes)
+    {
+        void* r = detail::reallocate(p, old_bytes, new_bytes);
+        assert(r && "velk::vector allocation failed");
+        return r;
+    }
+
     /** @brief Frees the raw buffer. Does not destroy elements. */
-    void free_raw() noexcept
+    void free_raw(size_t elem_size) noexcept
     {
-        std::free(data_);
+        dealloc_raw(data_, capacity_ * elem_size);
         data_ = nullptr;
         capacity_ = 0;
     }
@@ -78,16 +90,11 @@ protected:
         other.capacity_ = 0;
     }
 
-    /** @brief Grows the buffer via memcpy. */
+    /** @brief Grows the buffer via realloc. Trivially relocatable elements only. */
     void grow_raw(size_t required, size_t elem_size)
     {
         size_t new_cap = grow_capacity(capacity_, required);
-        void* new_buf = alloc_raw(new_cap * elem_size);
-        if (size_ > 0) {
-            std::memcpy(new_buf, data_, size_ * elem_size);
-        }
-        std::free(data_);
-        data_ = new_buf;
+        data_ = realloc_raw(data_, capacity_ * elem_size, new_cap * elem_size);
         capacity_ = new_cap;
     }
 
@@ -102,11 +109,13 @@ protected:
  * @brief ABI-stable owning resizable array.
  *
  * Replacement for std::vector in public interface headers.
- * Uses malloc/free for raw buffer management, making it safe across
- * DLL boundaries.
+ * Allocates raw buffers through the velk allocator (AllocatorSlot::Default),
+ * which lives in the velk DLL, making it safe across DLL boundaries.
  *
  * For trivially copyable types, all operations use memcpy/memmove/memset/memcmp.
  * For non-trivial types, uses placement new, explicit destructors, and move semantics.
+ * Types for which is_trivially_relocatable holds (e.g. shared_ptr, string) are
+ * relocated with realloc on growth and memmove on insert/erase.
  *
  * @tparam T The element type.
  */
@@ -114,6 +123,7 @@ template <class T>
 class vector : private vector_base
 {
     static constexpr bool trivial = std::is_trivially_copyable_v<T>;
+    static constexpr bool relocatable = is_trivially_relocatable_v<T>;
 
 public:
     using value_type = T; ///< The element type.
@@ -220,7 +230,7 @@ public:
     {
         if (this != &other) {
             destroy_all();
-            free_raw();
+            free_raw(sizeof(T));
             steal_from(other);
         }
         return *this;
@@ -230,7 +240,7 @@ public:
     ~vector()
     {
         destroy_all();
-        free_raw();
+        free_raw(sizeof(T));
     }
 
     /** @brief Returns a reference to the element at index @p i (unchecked). */
@@ -287,21 +297,21 @@ public:
             return;
         }
         if (size_ == 0) {
-            free_raw();
+            free_raw(sizeof(T));
             return;
         }
-        void* new_buf = alloc_raw(size_ * sizeof(T));
-        if constexpr (trivial) {
-            std::memcpy(new_buf, data_, size_ * sizeof(T));
+        if constexpr (relocatable) {
+            data_ = realloc_raw(data_, capacity_ * sizeof(T), size_ * sizeof(T));
         } else {
+            void* new_buf = alloc_raw(size_ * sizeof(T));
             T* dst = static_cast<T*>(new_buf);
             for (size_t i = 0; i < size_; ++i) {
                 new (dst + i) T(std::move(typed_data()[i]));
             }
             destroy_all();
+            dealloc_raw(data_, capacity_ * sizeof(T));
+            data_ = new_buf;
         }
-        std::free(data_);
-        data_ = new_buf;
         capacity_ = size_;
     }
 
@@ -373,6 +383,10 @@ public:
         T* d = typed_data();
         if constexpr (trivial) {
             insert_trivial(idx, &tmp, 1);
+        } else if constexpr (relocatable) {
+            open_gap(idx, 1);
+            new (d + idx) T(std::move(tmp));
+            ++size_;
         } else {
             if (size_ > idx) {
                 new (d + size_) T(std::move(d[size_ - 1]));
@@ -405,7 +419,14 @@ public:
             std::memcpy(tmp, first, count * sizeof(T));
             ensure_capacity(size_ + count);
             insert_trivial(idx, tmp, count);
-            std::free(tmp);
+            dealloc_raw(tmp, count * sizeof(T));
+        } else if constexpr (relocatable) {
+            vector tmp(first, last);
+            ensure_capacity(size_ + count);
+            open_gap(idx, count);
+            std::memcpy(static_cast<void*>(typed_data() + idx), tmp.data_, count * sizeof(T));
+            tmp.size_ = 0; // Elements now live in this vector
+            size_ += count;
         } else {
             vector tmp(first, last);
             ensure_capacity(size_ + count);
@@ -448,7 +469,8 @@ public:
     {
         size_t idx = static_cast<size_t>(pos - typed_data());
         assert(idx < size_);
-        if constexpr (trivial) {
+        if constexpr (relocatable) {
+            typed_data()[idx].~T();
             erase_trivial(idx, 1);
         } else {
             T* d = typed_data();
@@ -475,7 +497,8 @@ public:
         if (count == 0) {
             return d + idx;
         }
-        if constexpr (trivial) {
+        if constexpr (relocatable) {
+            destroy_range(d + idx, count);
             erase_trivial(idx, count);
         } else {
             for (size_t i = idx; i + count < size_; ++i) {
@@ -580,40 +603,41 @@ private:
     T* typed_data() { return static_cast<T*>(data_); }
     const T* typed_data() const { return static_cast<const T*>(data_); }
 
-    /** @brief Destroys all live elements without freeing the buffer. */
-    void destroy_all()
+    /** @brief Destroys @p count elements starting at @p first. */
+    static void destroy_range(T* first, size_t count)
     {
         if constexpr (!std::is_trivially_destructible_v<T>) {
-            T* d = typed_data();
-            for (size_t i = 0; i < size_; ++i) {
-                d[i].~T();
+            for (size_t i = 0; i < count; ++i) {
+                first[i].~T();
             }
         }
     }
 
+    /** @brief Destroys all live elements without freeing the buffer. */
+    void destroy_all() { destroy_range(typed_data(), size_); }
+
     /**
      * @brief Grows the buffer to hold at least @p required elements.
      *
-     * For trivial types uses memcpy; for non-trivial types moves elements.
+     * Trivially relocatable types are relocated with realloc, which can extend the
+     * buffer in place; other types are moved element by element.
      */
     void grow_to(size_t required)
     {
         size_t new_cap = grow_capacity(capacity_, required);
-        void* new_buf = alloc_raw(new_cap * sizeof(T));
-        if constexpr (trivial) {
-            if (size_ > 0) {
-                std::memcpy(new_buf, data_, size_ * sizeof(T));
-            }
+        if constexpr (relocatable) {
+            data_ = realloc_raw(data_, capacity_ * sizeof(T), new_cap * sizeof(T));
         } else {
+            void* new_buf = alloc_raw(new_cap * sizeof(T));
             T* dst = static_cast<T*>(new_buf);
             T* old = typed_data();
             for (size_t i = 0; i < size_; ++i) {
                 new (dst + i) T(std::move(old[i]));
             }
             destroy_all();
+            dealloc_raw(data_, capacity_ * sizeof(T));
+            data_ = new_buf;
         }
-        std::free(data_);
-        data_ = new_buf;
         capacity_ = new_cap;
     }
 
@@ -637,7 +661,17 @@ private:
         size_ += count;
     }
 
-    /** @brief Erases @p count elements at index @p idx via memmove. Trivial only. */
+    /** @brief Shifts the elements from index @p idx up by @p count via memmove. Size is unchanged. Relocatable only. */
+    void open_gap(size_t idx, size_t count)
+    {
+        char* d = static_cast<char*>(data_);
+        size_t tail = size_ - idx;
+        if (tail > 0) {
+            std::memmove(d + (idx + count) * sizeof(T), d + idx * sizeof(T), tail * sizeof(T));
+        }
+    }
+
+    /** @brief Closes a gap of @p count already destroyed elements at index @p idx via memmove. Relocatable only. */
     void erase_trivial(size_t idx, size_t count)
     {
         char* d = static_cast<char*>(data_);
@@ -649,6 +683,11 @@ private:
     }
 };
 
+/** @brief vector only holds a pointer to its heap buffer, so it is relocatable with memcpy. */
+template <class T>
+struct is_trivially_relocatable<vector<T>> : std::true_type
+{};
+
 } // namespace velk
 
 #endif // VELK_VECTOR_H
@@ -4,6 +4,7 @@
 #include <velk/plugins/animator/api/animation.h>
 #include <velk/plugins/animator/api/animator.h>
 #include <velk/plugins/animator/easing.h>
+#include <velk/plugins/animator/easing_bulk.h>
 #include <velk/plugins/animator/interpolator_traits.h>
 #include <velk/plugins/animator/plugin.h>
 
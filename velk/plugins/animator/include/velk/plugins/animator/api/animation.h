@@ -105,6 +105,13 @@ public:
         }
     }
 
+    /** @brief Pre-samples the curve at @p sampleRate samples per second. See IAnimationTrack::bake(). */
+    ReturnValue bake(float sampleRate)
+    {
+        auto* a = intf();
+        return a ? a->bake(sampleRate) : ReturnValue::Fail;
+    }
+
     /** @brief Returns the total duration, or zero if invalid. */
     Duration get_duration() const
     {
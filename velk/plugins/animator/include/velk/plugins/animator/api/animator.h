@@ -163,6 +163,23 @@ inline IAnimator& default_animator()
     return ap->get_default_animator();
 }
 
+/**
+ * @brief Creates an animator that is ticked automatically during instance().update().
+ *
+ * Animators of higher @p priority tick first. The animator keeps being ticked until the
+ * returned pointer and all other references to it are released.
+ */
+inline IAnimator::Ptr create_animator(int32_t priority = 0)
+{
+    auto* ap = get_or_load_plugin<IAnimatorPlugin>(PluginId::AnimatorPlugin);
+    if (!ap) {
+        return {};
+    }
+    auto animator = instance().create<IAnimator>(ClassId::Animator);
+    ap->add_animator(animator, priority);
+    return animator;
+}
+
 /** @brief Creates and installs an implicit transition on a property. Persists until remove() is called. */
 template <class T>
 Transition create_transition(Property<T> target, Duration duration, easing::EasingFn ease = easing::linear)
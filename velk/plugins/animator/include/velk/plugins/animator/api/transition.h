@@ -47,6 +47,14 @@ public:
         }
     }
 
+    /** @brief Sets the animator that ticks the transition. nullptr selects the default animator. */
+    void set_animator(const IAnimator::Ptr& animator)
+    {
+        if (auto* t = intf()) {
+            t->set_animator(animator);
+        }
+    }
+
     /** @brief Installs this transition on a property target. */
     void add_target(const IProperty::Ptr& target)
     {
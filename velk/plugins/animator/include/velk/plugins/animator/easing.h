@@ -2,6 +2,7 @@
 #define VELK_ANIMATOR_EASING_H
 
 #include <cmath>
+#include <cstdint>
 
 namespace velk::easing {
 
@@ -109,6 +110,60 @@ inline float in_bounce(float t)
     return 1.f - out_bounce(1.f - t);
 }
 
+/** @brief Identifies the built-in easing functions, so that batched code can switch on them. */
+enum class EasingId : uint8_t
+{
+    Custom, ///< Not a built-in easing function.
+    Linear,
+    InQuad,
+    OutQuad,
+    InOutQuad,
+    InCubic,
+    OutCubic,
+    InOutCubic,
+    InSine,
+    OutSine,
+    InOutSine,
+    InExpo,
+    OutExpo,
+    InOutExpo,
+    InElastic,
+    OutElastic,
+    InBounce,
+    OutBounce,
+    Count
+};
+
+/**
+ * @brief Returns the id of a built-in easing function, or EasingId::Custom.
+ *
+ * Call it at run time. Some compilers do not treat function pointer comparisons as
+ * constant expressions (GCC with -fsanitize=undefined, for example).
+ */
+constexpr EasingId easing_id(EasingFn fn)
+{
+    // clang-format off
+    return fn == nullptr || fn == linear ? EasingId::Linear
+         : fn == in_quad      ? EasingId::InQuad
+         : fn == out_quad     ? EasingId::OutQuad
+         : fn == in_out_quad  ? EasingId::InOutQuad
+         : fn == in_cubic     ? EasingId::InCubic
+         : fn == out_cubic    ? EasingId::OutCubic
+         : fn == in_out_cubic ? EasingId::InOutCubic
+         : fn == in_sine      ? EasingId::InSine
+         : fn == out_sine     ? EasingId::OutSine
+         : fn == in_out_sine  ? EasingId::InOutSine
+         : fn == in_expo      ? EasingId::InExpo
+         : fn == out_expo     ? EasingId::OutExpo
+         : fn == in_out_expo  ? EasingId::InOutExpo
+         : fn == in_elastic   ? EasingId::InElastic
+         : fn == out_elastic  ? EasingId::OutElastic
+         : fn == in_bounce    ? EasingId::InBounce
+         : fn == out_bounce   ? EasingId::OutBounce
+         : EasingId::Custom;
+    // clang-format on
+}
+
 } // namespace velk::easing
 
 #endif // VELK_ANIMATOR_EASING_H
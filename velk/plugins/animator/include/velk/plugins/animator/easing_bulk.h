@@ -0,0 +1,317 @@
+#ifndef VELK_ANIMATOR_EASING_BULK_H
+#define VELK_ANIMATOR_EASING_BULK_H
+
+#include <velk/plugins/animator/easing.h>
+#include <velk/vector.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file easing_bulk.h
+ * Array versions of the built-in easing functions.
+ *
+ * Each kernel eases n values in one call. The kernels are branch-free loops that compilers
+ * vectorize: piecewise curves compute every piece and pick one with a bitwise select, since
+ * a conditional expression keeps the loop scalar under the default -ftrapping-math.
+ *
+ * Instead of std::sin and std::pow the kernels use polynomial approximations (sin: degree 9
+ * after reduction to [-pi/2, pi/2], 2^x: degree 6 on [-0.5, 0.5]). For t in [0, 1] the
+ * absolute error against the scalar functions in easing.h is below 1e-5. The polynomial
+ * curves, and the endpoints of the expo and elastic curves, are exact. @p out may alias @p t.
+ *
+ * The animator evaluates batched animations with these kernels and every other animation
+ * with the scalar functions, so the sine, expo and elastic curves can differ by up to 1e-5
+ * between the two tick paths.
+ */
+
+namespace velk::easing {
+
+/** @brief Bulk easing signature: out[i] = easing(t[i]) for i in [0, n). */
+using BulkEasingFn = void (*)(const float* t, float* out, size_t n);
+
+namespace detail {
+
+constexpr float pi = 3.14159265358979323846f;
+constexpr float half_pi = pi * 0.5f;
+
+/** @brief Returns @p cond ? @p a : @p b without a branch. */
+inline float select(bool cond, float a, float b)
+{
+    uint32_t ua;
+    uint32_t ub;
+    std::memcpy(&ua, &a, sizeof(ua));
+    std::memcpy(&ub, &b, sizeof(ub));
+    uint32_t mask = 0u - static_cast<uint32_t>(cond);
+    uint32_t r = (ua & mask) | (ub & ~mask);
+    float f;
+    std::memcpy(&f, &r, sizeof(f));
+    return f;
+}
+
+/** @brief Rounds half away from zero, without a branch. */
+inline int32_t round_to_int(float x)
+{
+    return static_cast<int32_t>(x + std::copysign(0.5f, x));
+}
+
+/** @brief sin(x) for |x| up to ~1e5, absolute error below 4e-6. */
+inline float sin_approx(float x)
+{
+    // Reduce to [-pi, pi] with 2*pi split in two parts, then reflect to [-pi/2, pi/2]
+    float k = static_cast<float>(round_to_int(x * (0.5f / pi)));
+    float r = x - k * 6.28318548f - k * -1.74845553e-7f;
+    r = select(r > half_pi, pi - r, r);
+    r = select(r < -half_pi, -pi - r, r);
+    float r2 = r * r;
+    return r * (1.f + r2 * (-1.66666667e-1f + r2 * (8.33333333e-3f + r2 * (-1.98412698e-4f + r2 * 2.75573192e-6f))));
+}
+
+/** @brief 2^x, relative error below 2e-7. Results below 2^-126 are flushed to 2^-126. */
+inline float exp2_approx(float x)
+{
+    x = select(x < -126.f, -126.f, select(x > 127.f, 127.f, x));
+    int32_t k = round_to_int(x);
+    float f = x - static_cast<float>(k);
+    float p = 1.f + f * (6.93147181e-1f + f * (2.40226507e-1f + f * (5.55041087e-2f +
+              f * (9.61812911e-3f + f * (1.33335581e-3f + f * 1.54035304e-4f)))));
+    int32_t bits = (k + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+inline float bounce_out(float t)
+{
+    float a = 7.5625f * t * t;
+    float u = t - 1.5f / 2.75f;
+    float b = 7.5625f * u * u + 0.75f;
+    float v = t - 2.25f / 2.75f;
+    float c = 7.5625f * v * v + 0.9375f;
+    float w = t - 2.625f / 2.75f;
+    float d = 7.5625f * w * w + 0.984375f;
+    return select(t < 1.f / 2.75f, a, select(t < 2.f / 2.75f, b, select(t < 2.5f / 2.75f, c, d)));
+}
+
+} // namespace detail
+
+namespace bulk {
+
+inline void linear(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = t[i];
+    }
+}
+
+inline void in_quad(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = t[i] * t[i];
+    }
+}
+inline void out_quad(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = t[i] * (2.f - t[i]);
+    }
+}
+inline void in_out_quad(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        out[i] = detail::select(x < 0.5f, 2.f * x * x, -1.f + (4.f - 2.f * x) * x);
+    }
+}
+
+inline void in_cubic(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = t[i] * t[i] * t[i];
+    }
+}
+inline void out_cubic(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float u = t[i] - 1.f;
+        out[i] = u * u * u + 1.f;
+    }
+}
+inline void in_out_cubic(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        float u = 2.f * x - 2.f;
+        out[i] = detail::select(x < 0.5f, 4.f * x * x * x, (x - 1.f) * u * u + 1.f);
+    }
+}
+
+inline void in_sine(const float* t, float* out, size_t n)
+{
+    // 1 - cos(t * pi/2) = 1 - sin((1 - t) * pi/2)
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = 1.f - detail::sin_approx((1.f - t[i]) * detail::half_pi);
+    }
+}
+inline void out_sine(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = detail::sin_approx(t[i] * detail::half_pi);
+    }
+}
+inline void in_out_sine(const float* t, float* out, size_t n)
+{
+    // 0.5 * (1 - cos(t * pi)) = 0.5 * (1 - sin(pi/2 - t * pi))
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = 0.5f * (1.f - detail::sin_approx(detail::half_pi - t[i] * detail::pi));
+    }
+}
+
+inline void in_expo(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        float v = detail::exp2_approx(10.f * (x - 1.f));
+        out[i] = detail::select(x == 0.f, 0.f, v);
+    }
+}
+inline void out_expo(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        float v = 1.f - detail::exp2_approx(-10.f * x);
+        out[i] = detail::select(x == 1.f, 1.f, v);
+    }
+}
+inline void in_out_expo(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        bool lower = x < 0.5f;
+        float e = detail::exp2_approx(detail::select(lower, 20.f * x - 10.f, -20.f * x + 10.f));
+        float v = detail::select(lower, 0.5f * e, 1.f - 0.5f * e);
+        out[i] = detail::select((x == 0.f) | (x == 1.f), x, v);
+    }
+}
+
+inline void in_elastic(const float* t, float* out, size_t n)
+{
+    constexpr float c4 = 2.f * detail::pi / 3.f;
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        float v = -detail::exp2_approx(10.f * x - 10.f) * detail::sin_approx((x * 10.f - 10.75f) * c4);
+        out[i] = detail::select((x == 0.f) | (x == 1.f), x, v);
+    }
+}
+inline void out_elastic(const float* t, float* out, size_t n)
+{
+    constexpr float c4 = 2.f * detail::pi / 3.f;
+    for (size_t i = 0; i < n; ++i) {
+        float x = t[i];
+        float v = detail::exp2_approx(-10.f * x) * detail::sin_approx((x * 10.f - 0.75f) * c4) + 1.f;
+        out[i] = detail::select((x == 0.f) | (x == 1.f), x, v);
+    }
+}
+
+inline void out_bounce(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = detail::bounce_out(t[i]);
+    }
+}
+inline void in_bounce(const float* t, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = 1.f - detail::bounce_out(1.f - t[i]);
+    }
+}
+
+} // namespace bulk
+
+/** @brief Returns the bulk kernel of a built-in easing function, or nullptr for EasingId::Custom. */
+constexpr BulkEasingFn bulk_easing(EasingId id)
+{
+    switch (id) {
+    case EasingId::Linear: return bulk::linear;
+    case EasingId::InQuad: return bulk::in_quad;
+    case EasingId::OutQuad: return bulk::out_quad;
+    case EasingId::InOutQuad: return bulk::in_out_quad;
+    case EasingId::InCubic: return bulk::in_cubic;
+    case EasingId::OutCubic: return bulk::out_cubic;
+    case EasingId::InOutCubic: return bulk::in_out_cubic;
+    case EasingId::InSine: return bulk::in_sine;
+    case EasingId::OutSine: return bulk::out_sine;
+    case EasingId::InOutSine: return bulk::in_out_sine;
+    case EasingId::InExpo: return bulk::in_expo;
+    case EasingId::OutExpo: return bulk::out_expo;
+    case EasingId::InOutExpo: return bulk::in_out_expo;
+    case EasingId::InElastic: return bulk::in_elastic;
+    case EasingId::OutElastic: return bulk::out_elastic;
+    case EasingId::InBounce: return bulk::in_bounce;
+    case EasingId::OutBounce: return bulk::out_bounce;
+    default: return nullptr;
+    }
+}
+
+/**
+ * @brief Lookup table for an easing function.
+ *
+ * Samples the function at evenly spaced t and blends the two nearest samples. Inputs are
+ * clamped to [0, 1]. The error is bounded by max|f''| / (8 * (size - 1)^2). With the default
+ * size that is about 2.3e-5 for in_out_cubic (max|f''| = 12) and less for the other
+ * polynomial and sine curves, around 1e-3 for the expo and elastic ones, and larger at the
+ * kinks of the bounce curves, where f'' is unbounded.
+ */
+class EasingLut
+{
+public:
+    /** @brief Default number of samples. */
+    static constexpr size_t default_size = 256;
+
+    EasingLut() = default;
+    /** @brief Samples @p fn at @p size points (at least 2). */
+    explicit EasingLut(EasingFn fn, size_t size = default_size)
+    {
+        size = size < 2 ? 2 : size;
+        samples_.resize(size);
+        float step = 1.f / static_cast<float>(size - 1);
+        for (size_t i = 0; i < size; ++i) {
+            samples_[i] = fn(static_cast<float>(i) * step);
+        }
+        samples_[size - 1] = fn(1.f);
+        scale_ = static_cast<float>(size - 1);
+    }
+
+    /** @brief Returns true if the table has no samples. */
+    bool empty() const { return samples_.empty(); }
+    /** @brief Returns the number of samples. */
+    size_t size() const { return samples_.size(); }
+
+    /** @brief Returns the eased value of @p t. The table must not be empty. */
+    float operator()(float t) const
+    {
+        float x = (t < 0.f ? 0.f : (t > 1.f ? 1.f : t)) * scale_;
+        auto i = static_cast<size_t>(x);
+        i = i < samples_.size() - 1 ? i : samples_.size() - 2;
+        float f = x - static_cast<float>(i);
+        return samples_[i] + (samples_[i + 1] - samples_[i]) * f;
+    }
+
+    /** @brief Eases @p n values. @p out may alias @p t. */
+    void evaluate(const float* t, float* out, size_t n) const
+    {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = (*this)(t[i]);
+        }
+    }
+
+private:
+    vector<float> samples_;
+    float scale_ = 0.f;
+};
+
+} // namespace velk::easing
+
+#endif // VELK_ANIMATOR_EASING_BULK_H
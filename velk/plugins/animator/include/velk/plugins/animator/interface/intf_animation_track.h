@@ -69,6 +69,21 @@ public:
     virtual void seek(float progress) = 0;
     /** @brief Replaces all keyframes. Shares ownership of each entry's value. */
     virtual void set_keyframes(array_view<KeyframeEntry> keyframes) = 0;
+    /**
+     * @brief Pre-samples the eased curve into a table that ticks evaluate by lookup.
+     *
+     * Every tick, batched or not, and seek() then blend linearly between the two nearest
+     * samples instead of running the easing function and interpolator, so the error is
+     * bounded by the sample rate. The first and last keyframe are still applied exactly.
+     * The table is rebuilt from the new keyframes after set_keyframes().
+     * @param sampleRate Samples per second. 0 removes the table.
+     * @return Success if the table is in use (or was removed). Fail if it could not be built,
+     *         in which case playback stays exact: the value type has no bulk interpolator,
+     *         the track has no target or fewer than two keyframes yet, or the curve would
+     *         need too many samples. The rate is kept and the table is built once the
+     *         track can use it. InvalidArgument if @p sampleRate is negative.
+     */
+    virtual ReturnValue bake(float sampleRate) = 0;
 };
 
 } // namespace velk
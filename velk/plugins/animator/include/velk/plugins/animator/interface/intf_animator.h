@@ -6,11 +6,33 @@
 
 namespace velk {
 
+/**
+ * @brief Limits how often an animator evaluates an animation.
+ *
+ * A tick that is skipped is not lost: its time is added to the next evaluated tick, so a
+ * throttled animation keeps its timing and only updates its targets (and fires on_changed)
+ * less often. A default-constructed policy evaluates every tick.
+ */
+struct UpdatePolicy
+{
+    uint32_t frameInterval = 1; ///< Evaluate on every N-th tick. 0 and 1 evaluate every tick.
+    Duration minInterval{};     ///< Evaluate once at least this much time has passed since the last evaluation.
+    IProperty::Ptr enabled;     ///< Optional bool property. While it is false, evaluation is suspended.
+    /// Optional predicate. While it returns false, evaluation is suspended. Must not add or remove animations.
+    bool (*predicate)(void* context) = nullptr;
+    void* context = nullptr; ///< Passed to predicate.
+};
+
 /**
  * @brief Interface for an animator that manages and ticks a set of animations.
  *
  * Animations are added via add() and advanced each frame via tick().
- * The animator holds weak references; animations persist via property installation.
+ * The animator does not own its animations; they persist via property installation or
+ * handles, and leave the animator when they are destroyed. Only animations that are
+ * active (or have been played or retargeted since the last tick) are visited by tick().
+ *
+ * Each animator has its own clock: the dt passed to tick() is scaled by time_scale(), and
+ * a paused animator ignores its ticks.
  */
 class IAnimator : public Interface<IAnimator>
 {
@@ -27,6 +49,49 @@ public:
     virtual size_t active_count() const = 0;
     /** @brief Returns the total number of managed animations (excluding expired). */
     virtual size_t count() const = 0;
+    /**
+     * @brief Sets the number of threads tick() uses for batched animations.
+     *
+     * With more than one thread, batched animations are advanced and evaluated in parallel
+     * partitions on worker threads owned by the animator. Notifications and all other
+     * animations still run on the calling thread, in the order the animations were added.
+     * Animations writing the same property are kept in one partition. Easing functions and
+     * bulk interpolators of batched animations run on the workers and must be thread-safe.
+     * @param threads 0 or 1 (the default) ticks everything on the calling thread.
+     */
+    virtual void set_thread_count(size_t threads) = 0;
+    /** @brief Returns the number of threads used by tick(), including the calling thread. */
+    virtual size_t thread_count() const = 0;
+    /**
+     * @brief Evaluates custom easing functions of batched animations through lookup tables.
+     *
+     * Built-in easings always use their bulk kernels. A custom easing function is otherwise
+     * called once per value per tick; with a table it is sampled once and blended, see
+     * easing::EasingLut for the error. Animations that are not batched still call the
+     * function, so their values can differ from batched ones by that error.
+     * @param samples Number of samples per table. 0 (the default) calls the functions.
+     */
+    virtual void set_easing_lut_size(size_t samples) = 0;
+    /** @brief Throttles the whole animator: tick() only advances the animations when @p policy allows. */
+    virtual void set_update_policy(const UpdatePolicy& policy) = 0;
+    /**
+     * @brief Throttles one animation of the animator, on top of the animator's own policy.
+     * @return ReturnValue::Success, or ReturnValue::Fail if @p animation is not in the animator.
+     */
+    virtual ReturnValue set_update_policy(const IAnimation::Ptr& animation, const UpdatePolicy& policy) = 0;
+    /** @brief Scales the time the animations advance by on every tick. Default: 1. Negative values act as 0. */
+    virtual void set_time_scale(float scale) = 0;
+    /** @brief Returns the time scale. */
+    virtual float time_scale() const = 0;
+    /**
+     * @brief Pauses or resumes the animator's clock.
+     *
+     * While paused, tick() returns without visiting any animation, and the paused time is not
+     * caught up after resuming. The animations keep their own play state.
+     */
+    virtual void set_paused(bool paused) = 0;
+    /** @brief Returns true if the animator's clock is paused. */
+    virtual bool is_paused() const = 0;
 };
 
 } // namespace velk
@@ -6,12 +6,33 @@
 
 namespace velk {
 
-/** @brief Extended plugin interface exposing the default animator instance. */
+/**
+ * @brief Extended plugin interface exposing the default animator instance.
+ *
+ * The plugin ticks a list of animators during instance().update(), in descending priority.
+ * The default animator is in the list with priority 0. With a frame budget set, the
+ * animators that come after the budget has run out are deferred to the next update, where
+ * they advance by the time they missed. An animator is never deferred twice in a row.
+ * Paused animators are left out of the list until they resume.
+ */
 class IAnimatorPlugin : public Interface<IAnimatorPlugin>
 {
 public:
     /** @brief Returns the plugin's default animator. */
     virtual IAnimator& get_default_animator() const = 0;
+    /**
+     * @brief Adds @p animator to the animators ticked by instance().update(), or changes its priority.
+     *
+     * The plugin holds the animator by weak reference: it leaves the list when it is destroyed.
+     * Animators of equal priority tick in the order they were added.
+     */
+    virtual void add_animator(const IAnimator::Ptr& animator, int32_t priority = 0) = 0;
+    /** @brief Stops ticking @p animator during instance().update(). */
+    virtual void remove_animator(const IAnimator::Ptr& animator) = 0;
+    /** @brief Sets the time the animators may take per update. Zero (the default) ticks all of them. */
+    virtual void set_frame_budget(Duration budget) = 0;
+    /** @brief Returns the frame budget. */
+    virtual Duration get_frame_budget() const = 0;
 };
 
 } // namespace velk
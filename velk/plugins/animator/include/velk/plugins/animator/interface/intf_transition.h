@@ -5,6 +5,7 @@
 #include <velk/interface/intf_property.h>
 #include <velk/plugins/animator/easing.h>
 #include <velk/plugins/animator/interface/intf_animation.h>
+#include <velk/plugins/animator/interface/intf_animator.h>
 
 namespace velk {
 
@@ -27,6 +28,14 @@ public:
 
     /** @brief Sets the easing function. */
     virtual void set_easing(easing::EasingFn easing) = 0;
+    /**
+     * @brief Sets the animator that ticks the transition.
+     *
+     * A transition joins its animator when it gets its first target. Changing the animator
+     * of an installed transition moves it over.
+     * @param animator nullptr (the default) selects the plugin's default animator.
+     */
+    virtual void set_animator(const IAnimator::Ptr& animator) = 0;
 };
 
 } // namespace velk
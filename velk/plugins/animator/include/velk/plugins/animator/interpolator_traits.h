@@ -2,8 +2,11 @@
 #define VELK_ANIMATOR_INTERPOLATOR_TRAITS_H
 
 #include <velk/interface/intf_any.h>
+#include <velk/interface/intf_type_registry.h>
 #include <velk/interface/types.h>
 
+#include <cstddef>
+
 namespace velk {
 
 /**
@@ -18,6 +21,25 @@ struct interpolator_trait
     static T interpolate(const T& a, const T& b, float t) { return static_cast<T>(a + (b - a) * t); }
 };
 
+/**
+ * @brief Default bulk interpolation trait.
+ *
+ * Interpolates arrays of values element by element with interpolator_trait<T>. For
+ * arithmetic types the loop is a straight-line pass over dense arrays that the compiler
+ * vectorizes. Users may specialize this for custom types (e.g. to process vec3 or color
+ * channels with explicit SIMD); the result must match interpolator_trait<T>.
+ */
+template <class T>
+struct bulk_interpolator_trait
+{
+    static void interpolate(const T* from, const T* to, const float* t, T* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = interpolator_trait<T>::interpolate(from[i], to[i], t[i]);
+        }
+    }
+};
+
 namespace detail {
 
 /** @brief Typed interpolator callback: reads from/to IAny values, interpolates, writes to result IAny. */
@@ -34,7 +56,29 @@ ReturnValue typed_interpolator(const IAny& from, const IAny& to, float t, IAny&
     return ReturnValue::Fail;
 }
 
+/** @brief Typed bulk interpolator callback: interpolates raw arrays of T with bulk_interpolator_trait<T>. */
+template <class T>
+void typed_bulk_interpolator(const void* from, const void* to, const float* t, void* out, size_t count)
+{
+    bulk_interpolator_trait<T>::interpolate(
+        static_cast<const T*>(from), static_cast<const T*>(to), t, static_cast<T*>(out), count);
+}
+
 } // namespace detail
+
+/**
+ * @brief Registers the typed single-value and bulk interpolators of T with @p registry.
+ *
+ * Both are built from interpolator_trait<T> (and bulk_interpolator_trait<T>), so they
+ * always agree.
+ */
+template <class T>
+ReturnValue register_typed_interpolator(ITypeRegistry& registry)
+{
+    auto rv = registry.register_interpolator<T>(&detail::typed_interpolator<T>);
+    return failed(rv) ? rv : registry.register_bulk_interpolator<T>(&detail::typed_bulk_interpolator<T>);
+}
+
 } // namespace velk
 
 #endif // VELK_ANIMATOR_INTERPOLATOR_TRAITS_H
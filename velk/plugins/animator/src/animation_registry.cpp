@@ -0,0 +1,466 @@
+#include "animation_registry.h"
+
+#include <velk/api/any.h>
+#include <velk/interface/intf_object.h>
+
+#include <thread>
+#include <utility>
+
+namespace velk {
+
+namespace {
+
+/** @brief Removed slots tolerated before compact() runs, on top of the number of live ones. */
+constexpr size_t compact_threshold = 32;
+
+} // namespace
+
+bool UpdateThrottle::is_default(const UpdatePolicy& policy)
+{
+    return policy.frameInterval <= 1 && policy.minInterval.us <= 0 && !policy.enabled && !policy.predicate;
+}
+
+bool UpdateThrottle::advance(Duration& dt)
+{
+    pending.us += dt.us;
+    ++frames;
+    if (frames < policy.frameInterval || pending.us < policy.minInterval.us) {
+        return false;
+    }
+    if (policy.predicate && !policy.predicate(policy.context)) {
+        return false;
+    }
+    if (policy.enabled) {
+        bool enabled = true;
+        if (auto value = policy.enabled->get_value()) {
+            value->get_data(&enabled, sizeof(enabled), type_uid<bool>());
+        }
+        if (!enabled) {
+            return false;
+        }
+    }
+    dt = pending;
+    reset();
+    return true;
+}
+
+RegistryLink::StateGuard::StateGuard(RegistryLink& l) : link(l)
+{
+    while (link.guard_.exchange(true, std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+RegistryLink::StateGuard::~StateGuard()
+{
+    link.guard_.store(false, std::memory_order_release);
+}
+
+void RegistryLink::wake()
+{
+    if (!alive.load(std::memory_order_acquire) || woken.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    StateGuard guard(*this);
+    if (state_) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (alive.load(std::memory_order_relaxed)) {
+            state_->wakes.push_back(this);
+            return;
+        }
+    }
+    woken.store(false, std::memory_order_relaxed);
+}
+
+void RegistryLink::report_active(bool isActive)
+{
+    if (playing.load(std::memory_order_relaxed) == isActive) {
+        return;
+    }
+    StateGuard guard(*this);
+    if (!state_) {
+        playing.store(isActive, std::memory_order_relaxed);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (playing.exchange(isActive, std::memory_order_relaxed) == isActive) {
+        return;
+    }
+    if (alive.load(std::memory_order_relaxed)) {
+        if (isActive) {
+            state_->activeMembers.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            state_->activeMembers.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void RegistryLink::unlink()
+{
+    if (!alive.load(std::memory_order_acquire)) {
+        return;
+    }
+    shared_ptr<RegistryState> state;
+    uint32_t epoch = 0;
+    {
+        StateGuard guard(*this);
+        state = state_;
+        if (!state) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!alive.load(std::memory_order_relaxed)) {
+            return;
+        }
+        epoch = state->tickEpoch.load(std::memory_order_relaxed);
+        if ((epoch & 1) && state->ticker == std::this_thread::get_id()) {
+            // Released by a handler of the current tick, which checks alive() before it uses
+            // the animation again
+            auto* r = state->registry;
+            r->entries_[slot] = AnimationRegistry::Entry{};
+            ++r->removed_;
+            epoch = 0;
+        } else {
+            state->unlinked.push_back(slot);
+        }
+        AnimationRegistry::detach(*state, *this);
+    }
+    // A tick on another thread may still use the animation until it ends
+    if (epoch & 1) {
+        while (state->tickEpoch.load(std::memory_order_acquire) == epoch) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+AnimationRegistry::AnimationRegistry() : state_(::velk::make_shared<RegistryState>())
+{
+    state_->registry = this;
+}
+
+AnimationRegistry::~AnimationRegistry()
+{
+    clear();
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->registry = nullptr;
+}
+
+void AnimationRegistry::add(const IAnimation::Ptr& animation)
+{
+    if (!animation) {
+        return;
+    }
+    auto slot = static_cast<uint32_t>(entries_.size());
+    auto* member = interface_cast<IRegistryMember>(animation);
+    RegistryLink* link = member ? &member->registry_link() : nullptr;
+    if (link) {
+        RegistryLink::StateGuard guard(*link);
+        if (link->state_ && link->state_ != state_) {
+            std::lock_guard<std::mutex> lock(link->state_->mutex);
+            if (link->alive.load(std::memory_order_relaxed)) {
+                link = nullptr; // Linked to another animator, hold it by weak reference only here
+            }
+        }
+        if (link) {
+            link->state_ = state_;
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (link->alive.load(std::memory_order_relaxed)) {
+                return;
+            }
+            link->slot = slot;
+            link->active = true;
+            link->alive.store(true, std::memory_order_release);
+            state_->members.fetch_add(1, std::memory_order_relaxed);
+            if (link->playing.load(std::memory_order_relaxed)) {
+                state_->activeMembers.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    if (!link) {
+        for (auto& e : entries_) {
+            if (e.animation == animation.get() && !e.link && !e.weak.expired()) {
+                return;
+            }
+        }
+        ++foreign_;
+    }
+
+    Entry e;
+    e.animation = animation.get();
+    e.batched = interface_cast<IBatchedAnimation>(animation);
+    e.link = link;
+    e.weak = IAnimation::WeakPtr(animation);
+    entries_.push_back(std::move(e));
+    active_.push_back(slot);
+}
+
+void AnimationRegistry::remove(const IAnimation::Ptr& animation)
+{
+    auto slot = find_slot(animation);
+    if (slot != invalid_slot) {
+        remove_slot(slot);
+    }
+}
+
+uint32_t AnimationRegistry::find_slot(const IAnimation::Ptr& animation) const
+{
+    if (!animation) {
+        return invalid_slot;
+    }
+    auto* member = interface_cast<IRegistryMember>(animation);
+    if (member) {
+        // The caller holds the animation, so it cannot unlink concurrently, and only the
+        // ticking thread renumbers its slot
+        auto& link = member->registry_link();
+        if (link.state_ == state_ && link.alive.load(std::memory_order_acquire)) {
+            return link.slot;
+        }
+    }
+    for (uint32_t i = 0; i < entries_.size(); ++i) {
+        auto& e = entries_[i];
+        if (e.animation == animation.get() && !e.link && !e.weak.expired()) {
+            return i;
+        }
+    }
+    return invalid_slot;
+}
+
+bool AnimationRegistry::set_update_policy(const IAnimation::Ptr& animation, const UpdatePolicy& policy)
+{
+    auto slot = find_slot(animation);
+    if (slot == invalid_slot) {
+        return false;
+    }
+    auto& e = entries_[slot];
+    if (UpdateThrottle::is_default(policy)) {
+        e.throttle.reset();
+    } else {
+        if (!e.throttle) {
+            e.throttle = std::make_unique<UpdateThrottle>();
+        }
+        e.throttle->policy = policy;
+        e.throttle->reset();
+    }
+    return true;
+}
+
+void AnimationRegistry::detach(RegistryState& state, RegistryLink& link)
+{
+    link.alive.store(false, std::memory_order_release);
+    state.members.fetch_sub(1, std::memory_order_relaxed);
+    if (link.playing.load(std::memory_order_relaxed)) {
+        state.activeMembers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (link.woken.exchange(false, std::memory_order_acq_rel)) {
+        // The link may be destroyed right after this, it must not stay in the queue
+        for (size_t i = 0; i < state.wakes.size(); ++i) {
+            if (state.wakes[i] == &link) {
+                state.wakes.erase(state.wakes.begin() + static_cast<ptrdiff_t>(i));
+                break;
+            }
+        }
+    }
+}
+
+void AnimationRegistry::drain_unlinked()
+{
+    for (auto slot : state_->unlinked) {
+        entries_[slot] = Entry{};
+        ++removed_;
+    }
+    state_->unlinked.clear();
+}
+
+void AnimationRegistry::remove_slot(uint32_t slot)
+{
+    auto& e = entries_[slot];
+    if (!e.animation) {
+        return;
+    }
+    if (e.link) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        // A link whose unlink() has been queued is gone; every other link is still alive
+        drain_unlinked();
+        if (!e.animation) {
+            return;
+        }
+        e.link->active = false;
+        detach(*state_, *e.link);
+    } else {
+        --foreign_;
+    }
+    e = Entry{};
+    ++removed_;
+}
+
+void AnimationRegistry::clear()
+{
+    for (uint32_t i = 0; i < entries_.size(); ++i) {
+        remove_slot(i);
+    }
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->unlinked.clear();
+    }
+    entries_.clear();
+    active_.clear();
+    skipped_.clear();
+    removed_ = 0;
+}
+
+size_t AnimationRegistry::count() const
+{
+    size_t n = state_->members.load(std::memory_order_relaxed);
+    if (foreign_) {
+        for (auto& e : entries_) {
+            if (e.animation && !e.link && !e.weak.expired()) {
+                ++n;
+            }
+        }
+    }
+    return n;
+}
+
+size_t AnimationRegistry::active_count() const
+{
+    // Members report their state changes; woken animations count before they rejoin the list
+    size_t n = state_->activeMembers.load(std::memory_order_relaxed);
+    if (foreign_) {
+        for (auto& e : entries_) {
+            if (e.animation && !e.link) {
+                if (auto anim = e.weak.lock()) {
+                    n += anim->is_active() ? 1 : 0;
+                }
+            }
+        }
+    }
+    return n;
+}
+
+IAnimation::Ptr AnimationRegistry::lock(uint32_t slot) const
+{
+    auto& e = entries_[slot];
+    return e.animation ? e.weak.lock() : IAnimation::Ptr{};
+}
+
+void AnimationRegistry::drain_queued()
+{
+    drain_unlinked();
+    for (auto* link : state_->wakes) {
+        link->woken.store(false, std::memory_order_release);
+        if (!link->active && link->alive.load(std::memory_order_relaxed)) {
+            link->active = true;
+            active_.push_back(link->slot);
+            if (auto& throttle = entries_[link->slot].throttle) {
+                throttle->reset(); // Time spent idle is not owed to the animation
+            }
+        }
+    }
+    state_->wakes.clear();
+}
+
+void AnimationRegistry::compact()
+{
+    // Links are renumbered under the lock, so a concurrent unlink() queues the new slot
+    drain_unlinked();
+
+    // scratch_ maps old slots to new ones, removed slots map to invalid_slot
+    scratch_.resize(entries_.size());
+    uint32_t write = 0;
+    for (uint32_t i = 0; i < entries_.size(); ++i) {
+        if (!entries_[i].animation) {
+            scratch_[i] = invalid_slot;
+            continue;
+        }
+        scratch_[i] = write;
+        if (entries_[i].link) {
+            entries_[i].link->slot = write;
+        }
+        if (write != i) {
+            entries_[write] = std::move(entries_[i]);
+        }
+        ++write;
+    }
+    entries_.resize(write);
+
+    size_t active = 0;
+    for (auto slot : active_) {
+        if (scratch_[slot] != invalid_slot) {
+            active_[active++] = scratch_[slot];
+        }
+    }
+    active_.resize(active);
+    scratch_.clear();
+    removed_ = 0;
+}
+
+void AnimationRegistry::begin_tick(const UpdateInfo& info, vector<Ticked>& out)
+{
+    {
+        // From here on, a member released on another thread waits for end_tick() in unlink()
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        drain_queued();
+        if (removed_ > compact_threshold && removed_ > entries_.size() - removed_) {
+            compact();
+        }
+        state_->ticker = std::this_thread::get_id();
+        state_->tickEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    out.clear();
+    skipped_.clear();
+    for (auto slot : active_) {
+        auto& e = entries_[slot];
+        if (!e.animation) {
+            continue;
+        }
+        Duration dt = info.dt;
+        if (e.throttle && !e.throttle->advance(dt)) {
+            skipped_.push_back(slot);
+            continue;
+        }
+        if (e.link) {
+            out.push_back({slot, e.animation, e.batched, dt});
+        } else if (auto anim = e.weak.lock()) {
+            held_.push_back(std::move(anim));
+            out.push_back({slot, e.animation, e.batched, dt});
+        } else {
+            remove_slot(slot); // Expired
+        }
+    }
+    active_.clear();
+}
+
+void AnimationRegistry::end_tick(const vector<Ticked>& ticked)
+{
+    scratch_.clear();
+    for (auto& t : ticked) {
+        auto& e = entries_[t.slot];
+        if (!e.animation) {
+            continue;
+        }
+        if (e.link && !t.animation->is_active()) {
+            e.link->active = false; // Idle until it calls wake()
+            continue;
+        }
+        scratch_.push_back(t.slot);
+    }
+    for (auto slot : skipped_) {
+        if (entries_[slot].animation) {
+            scratch_.push_back(slot);
+        }
+    }
+    skipped_.clear();
+    // Animations added during the tick
+    for (auto slot : active_) {
+        if (entries_[slot].animation) {
+            scratch_.push_back(slot);
+        }
+    }
+    std::swap(active_, scratch_);
+    scratch_.clear();
+    held_.clear();
+    // Released members may finish their destruction now
+    state_->tickEpoch.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace velk
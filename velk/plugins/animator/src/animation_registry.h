@@ -0,0 +1,243 @@
+#ifndef VELK_ANIMATOR_ANIMATION_REGISTRY_H
+#define VELK_ANIMATOR_ANIMATION_REGISTRY_H
+
+#include "interpolation_batch.h"
+
+#include <velk/plugins/animator/interface/intf_animation.h>
+#include <velk/plugins/animator/interface/intf_animator.h>
+#include <velk/memory.h>
+#include <velk/vector.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace velk {
+
+class AnimationRegistry;
+struct RegistryLink;
+
+/**
+ * @brief The part of an AnimationRegistry that its links reach from other threads.
+ *
+ * Shared by the registry and the links that have joined it, so a link can still lock it
+ * while the registry is being destroyed.
+ */
+struct RegistryState
+{
+    std::mutex mutex;                      ///< Guards the members below and the slot of every link.
+    AnimationRegistry* registry = nullptr; ///< nullptr once the registry is destroyed.
+    vector<RegistryLink*> wakes;           ///< Links queued by wake().
+    vector<uint32_t> unlinked;             ///< Slots queued by unlink().
+    std::thread::id ticker;                ///< Thread of the current tick.
+    std::atomic<uint32_t> tickEpoch{0};    ///< Odd while a tick uses the raw pointers of its members.
+    std::atomic<size_t> members{0};        ///< Entries with a link.
+    std::atomic<size_t> activeMembers{0};  ///< Entries with a link that reports is_active().
+};
+
+/**
+ * @brief Intrusive membership of an animation in an AnimationRegistry.
+ *
+ * Embedded in the plugin's animation implementations. The registry keeps the slot of the
+ * animation here, so add() and remove() are O(1), the animation can ask to be ticked again
+ * after it went idle, and the registry counts active animations without visiting them.
+ * The slot and the alive flag are guarded by the mutex of the registry's RegistryState, so an
+ * animation can be woken or released on any thread.
+ */
+struct RegistryLink
+{
+    uint32_t slot = 0;                ///< Index in the registry's entries.
+    bool active = false;              ///< In the registry's active list. Used by the ticking thread only.
+    std::atomic<bool> alive{false};   ///< In a registry and not destroyed. Written under the state mutex.
+    std::atomic<bool> woken{false};   ///< Queued for reactivation by wake().
+    std::atomic<bool> playing{false}; ///< Last value passed to report_active().
+
+    /** @brief Puts the animation back in the active list on the next tick. Callable from any thread. */
+    void wake();
+    /** @brief Records whether the animation's is_active() is true. Callable from any thread. */
+    void report_active(bool isActive);
+    /**
+     * @brief Removes the animation from its registry. Called first thing in the animation's destructor.
+     *
+     * Callable from any thread. The slot is queued and cleared by the next tick or registry
+     * call on the ticking thread. If a tick on another thread is in progress, it may still be
+     * using the animation, so unlink() waits for that tick to end.
+     */
+    void unlink();
+
+private:
+    friend class AnimationRegistry;
+
+    /** @brief Holds guard_ for its lifetime. */
+    struct StateGuard
+    {
+        explicit StateGuard(RegistryLink& link);
+        ~StateGuard();
+        RegistryLink& link;
+    };
+
+    shared_ptr<RegistryState> state_; ///< State of the registry joined last. Guarded by guard_.
+    std::atomic<bool> guard_{false};  ///< Spin lock for state_, taken before the state mutex.
+};
+
+/** @brief Skip state of an UpdatePolicy. */
+struct UpdateThrottle
+{
+    UpdatePolicy policy;
+    uint32_t frames = 0; ///< Ticks since the last evaluation.
+    Duration pending{};  ///< Time since the last evaluation.
+
+    /** @brief Returns true if @p policy has no effect. */
+    static bool is_default(const UpdatePolicy& policy);
+    /**
+     * @brief Accounts for a tick of @p dt.
+     * @return true if the tick is evaluated, in which case @p dt is set to the time since the
+     *         last evaluation.
+     */
+    bool advance(Duration& dt);
+    void reset()
+    {
+        frames = 0;
+        pending = {};
+    }
+};
+
+/** @brief Plugin-internal interface of animations that carry a RegistryLink. */
+class IRegistryMember : public Interface<IRegistryMember>
+{
+public:
+    virtual RegistryLink& registry_link() = 0;
+};
+
+/**
+ * @brief The set of animations managed by an animator.
+ *
+ * Every animation is held by weak reference. Plugin animations (IRegistryMember) also carry a
+ * RegistryLink, which gives them an O(1) slot lookup, a place in the active list and cached
+ * counts. A tick uses their raw pointers without locking them: the link's alive flag is cleared
+ * by the destructor, which waits for a tick in progress on another thread. Other IAnimation
+ * implementations, and plugin animations that already belong to another animator, only have
+ * the weak reference, which a tick locks.
+ *
+ * Only the animations in the active list are visited by a tick. A member leaves the list
+ * when it is no longer active after a tick, and returns when it calls RegistryLink::wake().
+ * Animations that are not members always stay in the list. Animations with an UpdatePolicy
+ * stay in the list but are left out of the ticks their policy skips.
+ *
+ * Except for the RegistryLink calls, the registry must only be used from the thread that
+ * ticks it. Animations may be released on any thread.
+ */
+class AnimationRegistry
+{
+public:
+    static constexpr uint32_t invalid_slot = ~uint32_t(0);
+
+    /** @brief An animation visited by a tick. */
+    struct Ticked
+    {
+        uint32_t slot;
+        IAnimation* animation;
+        IBatchedAnimation* batched; ///< Non-null if the animation can be batched.
+        Duration dt;                ///< Time to advance the animation by.
+    };
+
+    AnimationRegistry();
+    ~AnimationRegistry();
+
+    /** @brief Adds @p animation to the registry and to the active list, unless it is already in. */
+    void add(const IAnimation::Ptr& animation);
+    /** @brief Removes @p animation from the registry. */
+    void remove(const IAnimation::Ptr& animation);
+    /** @brief Removes all animations. */
+    void clear();
+    /** @brief Sets the update policy of @p animation. Returns false if it is not in the registry. */
+    bool set_update_policy(const IAnimation::Ptr& animation, const UpdatePolicy& policy);
+
+    /**
+     * @brief Returns the number of animations, excluding expired ones.
+     *
+     * Members are counted by a cached counter; only animations held without a link are visited.
+     */
+    size_t count() const;
+    /**
+     * @brief Returns the number of animations whose is_active() is true.
+     *
+     * Members are counted from their RegistryLink::report_active() calls; only animations held
+     * without a link are visited.
+     */
+    size_t active_count() const;
+    /** @brief Returns the number of slots, including removed ones. */
+    size_t slot_count() const { return entries_.size(); }
+    /** @brief Returns the animation in @p slot, or nullptr if it was removed or has expired. */
+    IAnimation::Ptr lock(uint32_t slot) const;
+    /**
+     * @brief Returns true if @p slot has not been removed.
+     *
+     * Between begin_tick() and end_tick(), animations released on the ticking thread are removed
+     * at once, so this tells whether the raw pointers of a ticked animation are still valid.
+     */
+    bool alive(uint32_t slot) const { return entries_[slot].animation != nullptr; }
+
+    /**
+     * @brief Moves the active list into @p out.
+     *
+     * Also activates the woken animations and drops removed ones. Animations whose update
+     * policy skips a tick of @p info are kept aside instead. Animations added until end_tick()
+     * go to a fresh active list. Until end_tick(), an animation released on another thread
+     * waits in its destructor, so the raw pointers in @p out stay valid.
+     */
+    void begin_tick(const UpdateInfo& info, vector<Ticked>& out);
+    /**
+     * @brief Rebuilds the active list from the animations of begin_tick().
+     *
+     * Removed animations and members that are no longer active are dropped. The skipped
+     * animations and the animations added during the tick are appended.
+     */
+    void end_tick(const vector<Ticked>& ticked);
+
+private:
+    friend struct RegistryLink;
+
+    /**
+     * @brief A slot of the registry.
+     *
+     * animation, batched and link may dangle once weak has expired. For members they are used
+     * after the queued unlinks have been drained under the state mutex, which is also held
+     * when the tick starts, or during a tick. For other entries, only while weak is locked.
+     */
+    struct Entry
+    {
+        IAnimation* animation = nullptr; ///< nullptr once removed.
+        IBatchedAnimation* batched = nullptr;
+        RegistryLink* link = nullptr;    ///< nullptr if the animation is only held by weak.
+        IAnimation::WeakPtr weak;
+        std::unique_ptr<UpdateThrottle> throttle; ///< nullptr without an update policy.
+    };
+
+    /** @brief Returns the slot of @p animation, or invalid_slot. */
+    uint32_t find_slot(const IAnimation::Ptr& animation) const;
+    void remove_slot(uint32_t slot);
+    /** @brief Detaches @p link from @p state. Called with the state mutex held. */
+    static void detach(RegistryState& state, RegistryLink& link);
+    /** @brief Clears the slots queued by RegistryLink::unlink(). Called with the state mutex held. */
+    void drain_unlinked();
+    /** @brief Clears unlinked slots and activates woken links. Called with the state mutex held. */
+    void drain_queued();
+    /** @brief Drops the removed slots and renumbers the links. Called with the state mutex held. */
+    void compact();
+
+    vector<Entry> entries_;
+    vector<uint32_t> active_;  ///< Slots visited by the next tick.
+    vector<uint32_t> scratch_; ///< Reused by end_tick() and compact().
+    vector<uint32_t> skipped_; ///< Active slots left out of the current tick by their policy.
+    size_t removed_ = 0;       ///< Removed slots in entries_.
+    size_t foreign_ = 0;       ///< Live entries without a link.
+    vector<IAnimation::Ptr> held_; ///< Entries without a link, locked for the current tick.
+    shared_ptr<RegistryState> state_;
+};
+
+} // namespace velk
+
+#endif // VELK_ANIMATOR_ANIMATION_REGISTRY_H
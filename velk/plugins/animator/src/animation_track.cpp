@@ -6,11 +6,32 @@
 #include <velk/interface/intf_property.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
 
 namespace velk {
 
+namespace {
+
+/** @brief Keyframes a cursor walks forward before find_segment() switches to a binary search. */
+constexpr size_t max_cursor_steps = 4;
+
+/** @brief Upper bound for the number of samples in a baked table. */
+constexpr size_t max_baked_samples = size_t(1) << 20;
+
+float segment_progress(const KeyframeEntry& kf0, const KeyframeEntry& kf1, int64_t elapsed)
+{
+    int64_t seg_len = kf1.time.us - kf0.time.us;
+    return (seg_len > 0) ? static_cast<float>(elapsed - kf0.time.us) / static_cast<float>(seg_len) : 1.f;
+}
+
+} // namespace
+
 AnimationTrackImpl::~AnimationTrackImpl()
 {
+    // First, so that a tick on another thread is done with this animation
+    link_.unlink();
     if (transient_) {
         AnimationTrackImpl::uninstall();
     }
@@ -29,9 +50,10 @@ void AnimationTrackImpl::uninstall()
         }
     }
     targets_.clear();
-    display_ = nullptr;
-    result_ = nullptr;
+    display_.reset();
+    result_.reset();
     interpolator_ = nullptr;
+    bulk_ = nullptr;
 }
 
 void AnimationTrackImpl::set_transient(bool transient)
@@ -67,6 +89,21 @@ void AnimationTrackImpl::set_keyframes(array_view<KeyframeEntry> keyframes)
     sorted_ = false;
 }
 
+ReturnValue AnimationTrackImpl::bake(float sampleRate)
+{
+    auto* s = state();
+    if (!s) {
+        return ReturnValue::Fail;
+    }
+    if (!(sampleRate >= 0.f)) {
+        return ReturnValue::InvalidArgument;
+    }
+    sampleRate_ = sampleRate;
+    sorted_ = false;
+    ensure_init(*s);
+    return (sampleRate_ == 0.f || !baked_.empty()) ? ReturnValue::Success : ReturnValue::Fail;
+}
+
 void AnimationTrackImpl::play()
 {
     auto* s = state();
@@ -78,6 +115,7 @@ void AnimationTrackImpl::play()
         s->progress = 0.f;
     }
     s->state = PlayState::Playing;
+    link_.wake();
     notify_state(*s);
 }
 
@@ -122,6 +160,7 @@ void AnimationTrackImpl::restart()
     s->elapsed = {};
     s->progress = 0.f;
     s->state = PlayState::Playing;
+    link_.wake();
     notify_state(*s);
 }
 
@@ -159,16 +198,120 @@ void AnimationTrackImpl::ensure_init(IAnimationTrack::State& s)
     // Resolve type info and interpolator from first target's inner
     if (!targets_.empty() && targets_[0].inner) {
         auto& inner = targets_[0].inner;
-        auto types = inner->get_compatible_types();
-        if (!types.empty()) {
-            typeUid_ = types[0];
-            interpolator_ = instance().type_registry().find_interpolator(typeUid_);
-        }
-        result_ = inner->clone();
+        resolve_interpolator(*inner);
+        result_.assign(*inner);
     }
+    pack_keyframes(s);
+    bake_samples(s);
     sorted_ = true;
 }
 
+void AnimationTrackImpl::pack_keyframes(const IAnimationTrack::State& s)
+{
+    times_.clear();
+    values_.clear();
+    stride_ = 0;
+    cursor_ = 1;
+    for (auto& kf : s.keyframes) {
+        times_.push_back(kf.time.us);
+    }
+
+    // Packed values are interpolated with the bulk interpolator, by both the batched and the regular path
+    size_t size = bulk_ ? display_.get_data_size(typeUid_) : 0;
+    if (!size || size > InterpolationBatch::max_value_size) {
+        return;
+    }
+    values_.resize(s.keyframes.size() * size);
+    for (size_t i = 0; i < s.keyframes.size(); ++i) {
+        auto& value = s.keyframes[i].value;
+        if (!value || failed(value->get_data(values_.data() + i * size, size, typeUid_))) {
+            values_.clear();
+            return;
+        }
+    }
+    stride_ = size;
+}
+
+void AnimationTrackImpl::bake_samples(const IAnimationTrack::State& s)
+{
+    baked_.clear();
+    if (sampleRate_ <= 0.f || !stride_ || times_.size() < 2 || s.duration.us <= 0) {
+        return;
+    }
+    // The table is only built when every tick path can blend it in place
+    if (!result_.get_data_pointer(typeUid_)) {
+        return;
+    }
+    double seconds = static_cast<double>(s.duration.us) / 1e6;
+    double intervals = std::ceil(seconds * static_cast<double>(sampleRate_));
+    if (intervals < 1.0) {
+        intervals = 1.0;
+    }
+    if (intervals >= static_cast<double>(max_baked_samples)) {
+        return;
+    }
+    size_t count = static_cast<size_t>(intervals) + 1;
+    baked_.resize(count * stride_);
+    for (size_t k = 0; k < count; ++k) {
+        auto elapsed = static_cast<int64_t>(static_cast<double>(s.duration.us) * static_cast<double>(k) /
+                                            static_cast<double>(count - 1));
+        unsigned char* out = baked_.data() + k * stride_;
+        size_t i = find_segment(elapsed);
+        if (elapsed <= times_.front()) {
+            std::memcpy(out, values_.data(), stride_);
+        } else if (i >= times_.size()) {
+            std::memcpy(out, values_.data() + (times_.size() - 1) * stride_, stride_);
+        } else {
+            const unsigned char* from = values_.data() + (i - 1) * stride_;
+            auto& kf1 = s.keyframes[i];
+            float t = kf1.easing(segment_progress(s.keyframes[i - 1], kf1, elapsed));
+            bulk_(from, from + stride_, &t, out, 1);
+        }
+    }
+}
+
+const unsigned char* AnimationTrackImpl::baked_segment(int64_t elapsed, int64_t duration, float& t) const
+{
+    size_t last = baked_.size() / stride_ - 1;
+    double pos = static_cast<double>(elapsed) * static_cast<double>(last) / static_cast<double>(duration);
+    auto k = static_cast<size_t>(pos);
+    if (k >= last) {
+        k = last - 1;
+    }
+    t = static_cast<float>(pos - static_cast<double>(k));
+    return baked_.data() + k * stride_;
+}
+
+/** @brief Returns the index of the first keyframe with time > elapsed (the end of the current segment). */
+size_t AnimationTrackImpl::find_segment(int64_t elapsed)
+{
+    size_t n = times_.size();
+    size_t i = cursor_;
+    size_t first = 1;
+    if (i >= 1 && i <= n && (i == 1 || times_[i - 1] <= elapsed)) {
+        // Forward playback: the playhead is at or past the cached segment, usually in it
+        size_t steps = 0;
+        while (i < n && times_[i] <= elapsed && steps < max_cursor_steps) {
+            ++i;
+            ++steps;
+        }
+        if (i == n || times_[i] > elapsed) {
+            cursor_ = i;
+            return i;
+        }
+        first = i;
+    }
+    // Seek, reverse playback or a large step: binary search
+    if (first < n) {
+        i = static_cast<size_t>(std::upper_bound(times_.begin() + static_cast<ptrdiff_t>(first), times_.end(),
+                                                 elapsed) - times_.begin());
+    } else {
+        i = first;
+    }
+    cursor_ = i;
+    return i;
+}
+
 void AnimationTrackImpl::apply_at(IAnimationTrack::State& s)
 {
     if (!has_targets()) {
@@ -193,24 +336,36 @@ void AnimationTrackImpl::apply_at(IAnimationTrack::State& s)
         return;
     }
 
-    // Find the segment: first keyframe with time > elapsed
-    size_t i = 1;
-    while (i < s.keyframes.size() && s.keyframes[i].time.us <= s.elapsed.us) {
-        ++i;
+    // A baked table is sampled the same way as on the batched path; the easing is part of the table
+    if (!baked_.empty()) {
+        if (void* out = result_.get_data_pointer(typeUid_)) {
+            float t;
+            const unsigned char* from = baked_segment(s.elapsed.us, s.duration.us, t);
+            bulk_(from, from + stride_, &t, out, 1);
+            write_value(result_);
+            return;
+        }
     }
-    if (i >= s.keyframes.size() || !interpolator_ || !result_) {
+
+    size_t i = find_segment(s.elapsed.us);
+    if (i >= s.keyframes.size() || !result_) {
         return;
     }
 
     auto& kf0 = s.keyframes[i - 1];
     auto& kf1 = s.keyframes[i];
-    if (kf0.value && kf1.value) {
-        int64_t seg_len = kf1.time.us - kf0.time.us;
-        float seg_t = (seg_len > 0)
-                          ? static_cast<float>(s.elapsed.us - kf0.time.us) / static_cast<float>(seg_len)
-                          : 1.f;
-        interpolator_(*kf0.value, *kf1.value, kf1.easing(seg_t), *result_);
-        write_value(*result_);
+    // Packed values are read the same way as on the batched path, without touching the IAny entries
+    if (void* out = stride_ ? result_.get_data_pointer(typeUid_) : nullptr) {
+        const unsigned char* from = values_.data() + (i - 1) * stride_;
+        float t = kf1.easing(segment_progress(kf0, kf1, s.elapsed.us));
+        bulk_(from, from + stride_, &t, out, 1);
+        write_value(result_);
+        return;
+    }
+    if (interpolator_ && kf0.value && kf1.value) {
+        float seg_t = segment_progress(kf0, kf1, s.elapsed.us);
+        interpolator_(*kf0.value, *kf1.value, kf1.easing(seg_t), result_);
+        write_value(result_);
     }
 }
 
@@ -226,12 +381,19 @@ void AnimationTrackImpl::mark_finished(IAnimationTrack::State& s)
 void AnimationTrackImpl::write_value(const IAny& value)
 {
     if (display_) {
-        display_->copy_from(value);
+        display_.copy_from(value);
     }
     for (auto& entry : targets_) {
         if (entry.inner) {
             entry.inner->copy_from(value);
         }
+    }
+    queue_targets_changed();
+}
+
+void AnimationTrackImpl::queue_targets_changed()
+{
+    for (auto& entry : targets_) {
         auto prop = entry.owner.lock();
         if (prop) {
             auto pi = interface_pointer_cast<IPropertyInternal>(prop);
@@ -242,8 +404,19 @@ void AnimationTrackImpl::write_value(const IAny& value)
     }
 }
 
+void AnimationTrackImpl::resolve_interpolator(const IAny& inner)
+{
+    auto types = inner.get_compatible_types();
+    if (!types.empty()) {
+        typeUid_ = types[0];
+        interpolator_ = instance().type_registry().find_interpolator(typeUid_);
+        bulk_ = instance().type_registry().find_bulk_interpolator(typeUid_);
+    }
+}
+
 void AnimationTrackImpl::notify_state(IAnimationTrack::State& state)
 {
+    link_.report_active(state.state == PlayState::Playing);
     notify(MemberKind::Property, IAnimationTrack::UID, Notification::Changed);
 }
 
@@ -280,6 +453,81 @@ ReturnValue AnimationTrackImpl::tick(const UpdateInfo& info)
     return ReturnValue::Success;
 }
 
+// IBatchedAnimation
+
+bool AnimationTrackImpl::prepare_batched(vector<void*>& targets)
+{
+    // Only plain mid-animation ticks are batched. Starting, finishing and degenerate tracks
+    // take the regular tick(), which applies keyframe values exactly.
+    auto* st = state();
+    if (!st || st->state != PlayState::Playing || st->keyframes.size() < 2) {
+        return false;
+    }
+    // Sorting, packing and the type registry lookups happen here, on the ticking thread
+    ensure_init(*st);
+    if (!bulk_ || !stride_ || !display_.get_data_pointer(typeUid_)) {
+        return false;
+    }
+    // Every target must be writable in place, otherwise the whole track takes the regular path
+    writes_.clear();
+    for (auto& entry : targets_) {
+        if (entry.inner) {
+            void* target = entry.inner->get_data_pointer(typeUid_);
+            if (!target) {
+                return false;
+            }
+            writes_.push_back(target);
+        }
+    }
+    targets.insert(targets.end(), writes_.begin(), writes_.end());
+    return true;
+}
+
+bool AnimationTrackImpl::tick_batched(const UpdateInfo& info, InterpolationBatch& batch)
+{
+    auto* st = state();
+    if (!st || !sorted_) {
+        return false;
+    }
+    auto& s = *st;
+    int64_t elapsed = s.elapsed.us + info.dt.us;
+    if (elapsed <= 0 || elapsed >= s.duration.us) {
+        return false;
+    }
+
+    uint32_t lane;
+    if (!baked_.empty()) {
+        // Blend the two nearest samples; the easing is already part of the table
+        float t;
+        const unsigned char* from = baked_segment(elapsed, s.duration.us, t);
+        lane = batch.add_lane(bulk_, stride_, from, from + stride_, t, easing::linear);
+    } else {
+        size_t i = find_segment(elapsed);
+        if (i >= s.keyframes.size()) {
+            return false;
+        }
+        auto& kf0 = s.keyframes[i - 1];
+        auto& kf1 = s.keyframes[i];
+        const unsigned char* from = values_.data() + (i - 1) * stride_;
+        lane = batch.add_lane(bulk_, stride_, from, from + stride_, segment_progress(kf0, kf1, elapsed), kf1.easing);
+    }
+    s.elapsed.us = elapsed;
+    s.progress = static_cast<float>(elapsed) / static_cast<float>(s.duration.us);
+    batch.add_write(lane, display_.get_data_pointer(typeUid_));
+    for (void* target : writes_) {
+        batch.add_write(lane, target);
+    }
+    return true;
+}
+
+void AnimationTrackImpl::commit_batch()
+{
+    queue_targets_changed();
+    if (auto* s = state()) {
+        notify_state(*s);
+    }
+}
+
 // IAnyExtension
 
 IAny::ConstPtr AnimationTrackImpl::get_inner() const
@@ -291,14 +539,11 @@ void AnimationTrackImpl::set_inner(IAny::Ptr inner, const IInterface::WeakPtr& o
 {
     // First target entry: initialize display/result/interpolator
     if (targets_.empty() && inner) {
-        display_ = inner->clone();
-        result_ = inner->clone();
+        display_.assign(*inner);
+        result_ = display_;
 
-        auto types = inner->get_compatible_types();
-        if (!types.empty()) {
-            typeUid_ = types[0];
-            interpolator_ = instance().type_registry().find_interpolator(typeUid_);
-        }
+        resolve_interpolator(*inner);
+        sorted_ = false; // Repacks the keyframe values for the new type
     }
     targets_.push_back({owner, std::move(inner)});
 }
@@ -311,9 +556,10 @@ IAny::Ptr AnimationTrackImpl::take_inner(IInterface& owner)
             auto inner = std::move(it->inner);
             targets_.erase(it);
             if (targets_.empty()) {
-                display_ = nullptr;
-                result_ = nullptr;
+                display_.reset();
+                result_.reset();
                 interpolator_ = nullptr;
+                bulk_ = nullptr;
             }
             return inner;
         }
@@ -343,19 +589,19 @@ void AnimationTrackImpl::remove_target(const IProperty::Ptr& target)
 
 array_view<Uid> AnimationTrackImpl::get_compatible_types() const
 {
-    return display_ ? display_->get_compatible_types() : array_view<Uid>{};
+    return display_.get_compatible_types();
 }
 
 size_t AnimationTrackImpl::get_data_size(Uid type) const
 {
-    return display_ ? display_->get_data_size(type) : 0;
+    return display_.get_data_size(type);
 }
 
 ReturnValue AnimationTrackImpl::get_data(void* to, size_t toSize, Uid type) const
 {
     auto* s = state();
     if (s && (s->state == PlayState::Playing || s->state == PlayState::Paused)) {
-        return display_ ? display_->get_data(to, toSize, type) : ReturnValue::Fail;
+        return display_.get_data(to, toSize, type);
     }
     return (!targets_.empty() && targets_[0].inner) ? targets_[0].inner->get_data(to, toSize, type)
                                                     : ReturnValue::Fail;
@@ -373,7 +619,7 @@ ReturnValue AnimationTrackImpl::set_data(void const* from, size_t fromSize, Uid
         }
     }
     if (display_ && succeeded(ret)) {
-        display_->set_data(from, fromSize, type);
+        display_.set_data(from, fromSize, type);
     }
     return ret;
 }
@@ -390,15 +636,25 @@ ReturnValue AnimationTrackImpl::copy_from(const IAny& other)
         }
     }
     if (display_ && succeeded(ret)) {
-        display_->copy_from(other);
+        display_.copy_from(other);
     }
     return ret;
 }
 
 IAny::Ptr AnimationTrackImpl::clone() const
 {
-    return display_ ? display_->clone()
+    return display_ ? display_.clone()
                     : ((!targets_.empty() && targets_[0].inner) ? targets_[0].inner->clone() : nullptr);
 }
 
+ReturnValue AnimationTrackImpl::clone_into(AnyBuffer& buffer) const
+{
+    auto* s = state();
+    if (s && (s->state == PlayState::Playing || s->state == PlayState::Paused)) {
+        return display_.clone_into(buffer);
+    }
+    return (!targets_.empty() && targets_[0].inner) ? targets_[0].inner->clone_into(buffer)
+                                                    : ReturnValue::Fail;
+}
+
 } // namespace velk
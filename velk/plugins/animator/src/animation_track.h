@@ -1,7 +1,11 @@
 #ifndef VELK_ANIMATOR_ANIMATION_TRACK_IMPL_H
 #define VELK_ANIMATOR_ANIMATION_TRACK_IMPL_H
 
+#include "animation_registry.h"
+#include "interpolation_batch.h"
+
 #include <velk/ext/object.h>
+#include <velk/inline_any.h>
 #include <velk/plugins/animator/interface/intf_animation_track.h>
 #include <velk/plugins/animator/plugin.h>
 #include <velk/vector.h>
@@ -14,8 +18,21 @@ namespace velk {
  * Installed on one or more properties via install_extension. Drives values from
  * keyframes during tick(), writing directly to all inners and firing on_changed
  * via each owner.
+ *
+ * Tracks of types with a bulk interpolator whose targets expose their storage are
+ * evaluated through the animator's InterpolationBatch instead (see IBatchedAnimation).
+ *
+ * On init the keyframe times, and for batchable types the keyframe values, are packed into
+ * contiguous arrays. Both tick paths interpolate from the packed values. The arrays are a
+ * cache that adds to the track's memory: State::keyframes is readable through the interface
+ * and keeps the IAny of each KeyframeEntry. The active segment is found from a cursor that
+ * follows the playhead, so forward playback costs O(1) per tick regardless of the number
+ * of keyframes. A baked
+ * track also samples the eased curve into baked_, and both tick paths and seek() only blend
+ * two samples.
  */
-class AnimationTrackImpl : public ext::Object<AnimationTrackImpl, IAnimationTrack, IAnyExtension>
+class AnimationTrackImpl
+    : public ext::Object<AnimationTrackImpl, IAnimationTrack, IAnyExtension, IBatchedAnimation, IRegistryMember>
 {
 public:
     VELK_CLASS_UID(ClassId::AnimationTrack);
@@ -38,6 +55,7 @@ public:
     void restart() override;
     void seek(float progress) override;
     void set_keyframes(array_view<KeyframeEntry> keyframes) override;
+    ReturnValue bake(float sampleRate) override;
 
     // IAnyExtension
     IAny::ConstPtr get_inner() const override;
@@ -51,6 +69,16 @@ public:
     ReturnValue set_data(void const* from, size_t fromSize, Uid type) override;
     ReturnValue copy_from(const IAny& other) override;
     IAny::Ptr clone() const override;
+    ReturnValue clone_into(AnyBuffer& buffer) const override;
+    void* get_data_pointer(Uid) override { return nullptr; }
+
+    // IBatchedAnimation
+    bool prepare_batched(vector<void*>& targets) override;
+    bool tick_batched(const UpdateInfo& info, InterpolationBatch& batch) override;
+    void commit_batch() override;
+
+    // IRegistryMember
+    RegistryLink& registry_link() override { return link_; }
 
 private:
     struct TargetEntry
@@ -62,19 +90,34 @@ private:
     IAnimationTrack::State* state();
     const IAnimationTrack::State* state() const;
     void ensure_init(IAnimationTrack::State& state);
+    void pack_keyframes(const IAnimationTrack::State& state);
+    void bake_samples(const IAnimationTrack::State& state);
+    size_t find_segment(int64_t elapsed);
+    const unsigned char* baked_segment(int64_t elapsed, int64_t duration, float& t) const;
     void apply_at(IAnimationTrack::State& s);
     void mark_finished(IAnimationTrack::State& s);
     void write_value(const IAny& value);
+    void queue_targets_changed();
+    void resolve_interpolator(const IAny& inner);
     void notify_state(IAnimationTrack::State& state);
     bool has_targets() const { return !targets_.empty(); }
 
     vector<TargetEntry> targets_;
-    IAny::Ptr display_;
+    InlineAny<> display_;
     InterpolatorFn interpolator_ = nullptr;
-    IAny::Ptr result_;
+    BulkInterpolatorFn bulk_ = nullptr;
+    InlineAny<> result_;
     Uid typeUid_{};
+    vector<int64_t> times_;        ///< Keyframe times in microseconds, sorted.
+    vector<unsigned char> values_; ///< Keyframe values at stride_ bytes each, if batchable.
+    size_t stride_ = 0;            ///< Value size in values_, 0 if the values are not packed.
+    size_t cursor_ = 1;            ///< Segment returned by the previous find_segment().
+    vector<unsigned char> baked_;  ///< Evenly spaced curve samples at stride_ bytes each.
+    vector<void*> writes_;         ///< Target storage found by prepare_batched().
+    float sampleRate_ = 0.f;       ///< Samples per second requested by bake(), 0 if not baked.
     bool sorted_ = false;
     bool transient_ = false;
+    RegistryLink link_;
 };
 
 } // namespace velk
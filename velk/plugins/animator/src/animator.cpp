@@ -4,80 +4,263 @@
 
 namespace velk {
 
-void AnimatorImpl::tick(const UpdateInfo& info)
+namespace {
+
+/** @brief Smallest number of animations worth handing to a worker thread. */
+constexpr size_t min_partition_size = 64;
+
+} // namespace
+
+void AnimatorImpl::tick(const UpdateInfo& frame)
 {
-    size_t write = 0;
-    for (size_t i = 0; i < animations_.size(); ++i) {
-        auto anim = animations_[i].lock();
-        if (!anim) {
-            continue;
+    if (paused_) {
+        return;
+    }
+    UpdateInfo info = frame;
+    if (timeScale_ != 1.f) {
+        double scaled = static_cast<double>(info.dt.us) * timeScale_ + scaleRemainder_;
+        info.dt.us = static_cast<int64_t>(scaled);
+        scaleRemainder_ = scaled - static_cast<double>(info.dt.us);
+    }
+    if (throttle_ && !throttle_->advance(info.dt)) {
+        return;
+    }
+    registry_.begin_tick(info, pending_);
+
+    // Phase 1: batched animations add their values to the batch of their partition, which
+    // is then evaluated. Animations that write the same storage share a partition, so each
+    // target is written by one thread, in animation order. Custom easing functions and bulk
+    // interpolators run on the worker threads.
+    size_t partitions = prepare_partitions();
+    if (batches_.size() < partitions) {
+        size_t first = batches_.size();
+        batches_.resize(partitions);
+        for (size_t i = first; i < partitions; ++i) {
+            batches_[i].set_easing_lut_size(lutSize_);
         }
-        anim->tick(info);
-        animations_[write++] = animations_[i];
     }
-    animations_.resize(write); // Removes any IAnimation::WeakPtrs whose .lock() failed above.
+    info_ = &info;
+    workers_.run(
+        partitions, [](void* self, size_t index) { static_cast<AnimatorImpl*>(self)->tick_partition(index); },
+        this);
+    info_ = nullptr;
+
+    // Phase 2: notify and tick the remaining animations, in animation order. User code may
+    // add, remove or release animations from here on, so the list is detached first.
+    auto pending = std::move(pending_);
+    for (auto& p : pending) {
+        if (!registry_.alive(p.slot)) {
+            continue; // Removed by an earlier handler
+        }
+        if (p.batched) {
+            p.batched->commit_batch();
+        } else {
+            info.dt = p.dt;
+            p.animation->tick(info);
+        }
+    }
+    registry_.end_tick(pending);
+    pending.clear();
+    pending_ = std::move(pending); // Keeps the capacity for the next tick
 }
 
-void AnimatorImpl::add(const IAnimation::Ptr& animation)
+size_t AnimatorImpl::prepare_partitions()
 {
-    if (!animation) {
-        return;
+    // Phase 0, on the calling thread: batched animations resolve anything that touches shared
+    // state and report the storage they write
+    targets_.clear();
+    targetBegin_.clear();
+    size_t batched = 0;
+    for (auto& p : pending_) {
+        size_t first = targets_.size();
+        targetBegin_.push_back(static_cast<uint32_t>(first));
+        if (p.batched && !p.batched->prepare_batched(targets_)) {
+            p.batched = nullptr;
+            targets_.resize(first);
+        }
+        batched += p.batched ? 1 : 0;
+    }
+    targetBegin_.push_back(static_cast<uint32_t>(targets_.size()));
+
+    size_t partitions = workers_.thread_count();
+    size_t max_partitions = (batched + min_partition_size - 1) / min_partition_size;
+    if (partitions > max_partitions) {
+        partitions = max_partitions ? max_partitions : 1;
     }
-    for (auto& weak : animations_) {
-        auto locked = weak.lock();
-        if (locked && locked.get() == animation.get()) {
-            return;
+
+    // Split the batched animations into contiguous runs, except that an animation joins the
+    // partition of an earlier one that writes the same target. An animation that would join
+    // two partitions makes the whole tick run in one.
+    partitionOf_.clear();
+    partitionOf_.resize(pending_.size(), 0);
+    if (partitions > 1) {
+        size_t capacity = 16;
+        while (capacity < targets_.size() * 2) {
+            capacity *= 2;
+        }
+        owners_.clear();
+        owners_.resize(capacity, TargetOwner{});
+        size_t mask = capacity - 1;
+        auto slot = [&](void* target) -> TargetOwner& {
+            auto h = reinterpret_cast<uintptr_t>(target);
+            size_t i = static_cast<size_t>((h >> 4) ^ (h >> 16)) & mask;
+            while (owners_[i].target && owners_[i].target != target) {
+                i = (i + 1) & mask;
+            }
+            return owners_[i];
+        };
+        size_t k = 0;
+        for (size_t i = 0; i < pending_.size() && partitions > 1; ++i) {
+            if (!pending_[i].batched) {
+                continue;
+            }
+            uint32_t part = static_cast<uint32_t>(k++ * partitions / batched);
+            uint32_t joined = invalid_partition;
+            for (uint32_t t = targetBegin_[i]; t < targetBegin_[i + 1]; ++t) {
+                auto& owner = slot(targets_[t]);
+                if (!owner.target) {
+                    continue;
+                }
+                if (joined != invalid_partition && joined != owner.partition) {
+                    partitions = 1;
+                    break;
+                }
+                joined = owner.partition;
+            }
+            if (joined != invalid_partition) {
+                part = joined;
+            }
+            for (uint32_t t = targetBegin_[i]; t < targetBegin_[i + 1]; ++t) {
+                auto& owner = slot(targets_[t]);
+                owner.target = targets_[t];
+                owner.partition = part;
+            }
+            partitionOf_[i] = part;
+        }
+        if (partitions == 1) {
+            partitionOf_.clear();
+            partitionOf_.resize(pending_.size(), 0);
         }
     }
-    animations_.push_back(IAnimation::WeakPtr(animation));
+
+    // Order the batched animations by partition, keeping animation order within each
+    partitionBegin_.clear();
+    partitionBegin_.resize(partitions + 1, 0);
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        if (pending_[i].batched) {
+            ++partitionBegin_[partitionOf_[i] + 1];
+        }
+    }
+    for (size_t i = 1; i <= partitions; ++i) {
+        partitionBegin_[i] += partitionBegin_[i - 1];
+    }
+    order_.resize(batched);
+    scratch_.clear();
+    scratch_.insert(scratch_.end(), partitionBegin_.begin(), partitionBegin_.end() - 1);
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        if (pending_[i].batched) {
+            order_[scratch_[partitionOf_[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+    return partitions;
 }
 
-void AnimatorImpl::remove(const IAnimation::Ptr& animation)
+void AnimatorImpl::tick_partition(size_t index)
 {
-    if (!animation) {
-        return;
-    }
-    for (size_t i = 0; i < animations_.size(); ++i) {
-        auto locked = animations_[i].lock();
-        if (locked && locked.get() == animation.get()) {
-            animations_.erase(animations_.begin() + static_cast<ptrdiff_t>(i));
-            return;
+    auto& batch = batches_[index];
+    batch.clear();
+    UpdateInfo info = *info_;
+    for (uint32_t k = partitionBegin_[index]; k < partitionBegin_[index + 1]; ++k) {
+        auto& p = pending_[order_[k]];
+        info.dt = p.dt;
+        if (!p.batched->tick_batched(info, batch)) {
+            p.batched = nullptr;
         }
     }
+    batch.evaluate();
+}
+
+void AnimatorImpl::add(const IAnimation::Ptr& animation)
+{
+    registry_.add(animation);
+}
+
+void AnimatorImpl::remove(const IAnimation::Ptr& animation)
+{
+    registry_.remove(animation);
 }
 
 void AnimatorImpl::cancel_all()
 {
-    for (auto& weak : animations_) {
-        auto anim = weak.lock();
-        if (anim) {
+    for (uint32_t i = 0; i < registry_.slot_count(); ++i) {
+        if (auto anim = registry_.lock(i)) {
             anim->uninstall();
         }
     }
-    animations_.clear();
+    registry_.clear();
 }
 
 size_t AnimatorImpl::active_count() const
 {
-    size_t n = 0;
-    for (auto& weak : animations_) {
-        auto anim = weak.lock();
-        if (anim && anim->is_active()) {
-            ++n;
-        }
-    }
-    return n;
+    return registry_.active_count();
 }
 
 size_t AnimatorImpl::count() const
 {
-    size_t n = 0;
-    for (auto& weak : animations_) {
-        if (weak.lock()) {
-            ++n;
-        }
+    return registry_.count();
+}
+
+void AnimatorImpl::set_thread_count(size_t threads)
+{
+    workers_.set_thread_count(threads);
+}
+
+size_t AnimatorImpl::thread_count() const
+{
+    return workers_.thread_count();
+}
+
+void AnimatorImpl::set_easing_lut_size(size_t samples)
+{
+    lutSize_ = samples;
+    for (auto& batch : batches_) {
+        batch.set_easing_lut_size(samples);
+    }
+}
+
+void AnimatorImpl::set_update_policy(const UpdatePolicy& policy)
+{
+    if (UpdateThrottle::is_default(policy)) {
+        throttle_.reset();
+        return;
+    }
+    if (!throttle_) {
+        throttle_ = std::make_unique<UpdateThrottle>();
     }
-    return n;
+    throttle_->policy = policy;
+    throttle_->reset();
+}
+
+ReturnValue AnimatorImpl::set_update_policy(const IAnimation::Ptr& animation, const UpdatePolicy& policy)
+{
+    return registry_.set_update_policy(animation, policy) ? ReturnValue::Success : ReturnValue::Fail;
+}
+
+void AnimatorImpl::set_paused(bool paused)
+{
+    if (paused_ == paused) {
+        return;
+    }
+    paused_ = paused;
+    if (scheduler_) {
+        scheduler_->on_paused_changed(*this, paused);
+    }
+}
+
+void AnimatorImpl::set_time_scale(float scale)
+{
+    timeScale_ = scale > 0.f ? scale : 0.f;
+    scaleRemainder_ = 0.0;
 }
 
 } // namespace velk
@@ -1,6 +1,10 @@
 #ifndef VELK_ANIMATOR_IMPL_H
 #define VELK_ANIMATOR_IMPL_H
 
+#include "animation_registry.h"
+#include "interpolation_batch.h"
+#include "worker_pool.h"
+
 #include <velk/ext/object.h>
 #include <velk/plugins/animator/interface/intf_animator.h>
 #include <velk/plugins/animator/plugin.h>
@@ -8,7 +12,45 @@
 
 namespace velk {
 
-class AnimatorImpl : public ext::Object<AnimatorImpl, IAnimator>
+/** @brief Told when a scheduled animator pauses or resumes (implemented by the animator plugin). */
+class IAnimatorScheduler
+{
+public:
+    virtual void on_paused_changed(IAnimator& animator, bool paused) = 0;
+
+protected:
+    ~IAnimatorScheduler() = default;
+};
+
+/** @brief Internal interface through which the animator plugin registers itself as scheduler. */
+class IScheduledAnimator : public Interface<IScheduledAnimator>
+{
+public:
+    /** @brief Sets the scheduler told about pause changes, or nullptr. */
+    virtual void set_scheduler(IAnimatorScheduler* scheduler) = 0;
+};
+
+/**
+ * @brief Default IAnimator implementation.
+ *
+ * Animations are kept in an AnimationRegistry, and only its active list is visited per
+ * tick. Animations implementing IBatchedAnimation contribute their values to a shared
+ * InterpolationBatch that is evaluated once per tick; all other animations are ticked
+ * one by one.
+ *
+ * With set_thread_count() above one, the batched animations are split into contiguous
+ * partitions that are advanced and evaluated in parallel, each into its own batch.
+ * Animations that write the same property storage are kept in one partition, so the last
+ * one in animation order wins as it does on a single thread. The notifications are still
+ * fired in animation order on the calling thread, so the result does not depend on the
+ * thread count.
+ *
+ * The dt of a tick is first scaled by the animator's clock, which a pause stops altogether.
+ * An UpdatePolicy on the animator then skips whole ticks; one on an animation only leaves that
+ * animation out. Either way the skipped time is handed to the next evaluated tick. While
+ * paused, the animator plugin takes the animator out of the list it ticks.
+ */
+class AnimatorImpl : public ext::Object<AnimatorImpl, IAnimator, IScheduledAnimator>
 {
 public:
     VELK_CLASS_UID(ClassId::Animator);
@@ -19,9 +61,55 @@ public:
     void cancel_all() override;
     size_t active_count() const override;
     size_t count() const override;
+    void set_thread_count(size_t threads) override;
+    size_t thread_count() const override;
+    void set_easing_lut_size(size_t samples) override;
+    void set_update_policy(const UpdatePolicy& policy) override;
+    ReturnValue set_update_policy(const IAnimation::Ptr& animation, const UpdatePolicy& policy) override;
+    void set_time_scale(float scale) override;
+    float time_scale() const override { return timeScale_; }
+    void set_paused(bool paused) override;
+    bool is_paused() const override { return paused_; }
+
+    void set_scheduler(IAnimatorScheduler* scheduler) override { scheduler_ = scheduler; }
 
 private:
-    vector<IAnimation::WeakPtr> animations_;
+    static constexpr uint32_t invalid_partition = ~uint32_t(0);
+
+    /** @brief Entry of the table that maps target storage to the partition writing it. */
+    struct TargetOwner
+    {
+        void* target{};
+        uint32_t partition{};
+    };
+
+    /**
+     * @brief Prepares the batched animations of pending_ and assigns them to partitions.
+     * @return The number of partitions.
+     */
+    size_t prepare_partitions();
+    /** @brief Advances and evaluates the batched animations in one partition of pending_. */
+    void tick_partition(size_t index);
+
+    AnimationRegistry registry_;
+    vector<InterpolationBatch> batches_; ///< One batch per partition.
+    /// Animations of the current tick. batched is reset if the animation was not added to a batch.
+    vector<AnimationRegistry::Ticked> pending_;
+    const UpdateInfo* info_{};           ///< Update being ticked, for tick_partition().
+    vector<void*> targets_;              ///< Storage written by the batched animations.
+    vector<uint32_t> targetBegin_;       ///< First entry in targets_ of each pending_ animation.
+    vector<TargetOwner> owners_;         ///< Open-addressing table over targets_.
+    vector<uint32_t> partitionOf_;       ///< Partition of each pending_ animation.
+    vector<uint32_t> partitionBegin_;    ///< First entry in order_ of each partition.
+    vector<uint32_t> order_;             ///< Batched pending_ animations, ordered by partition.
+    vector<uint32_t> scratch_;
+    WorkerPool workers_;
+    std::unique_ptr<UpdateThrottle> throttle_; ///< Animator-wide policy, nullptr if none.
+    size_t lutSize_ = 0; ///< Easing table size of the batches.
+    float timeScale_ = 1.f;
+    double scaleRemainder_ = 0.0; ///< Fraction of a microsecond lost by the last scaled dt.
+    IAnimatorScheduler* scheduler_{}; ///< Animator plugin ticking this animator, if any.
+    bool paused_ = false;
 };
 
 } // namespace velk
@@ -2,6 +2,8 @@
 
 #include <velk/ext/any.h>
 
+#include <chrono>
+
 namespace velk {
 
 ReturnValue AnimatorPlugin::initialize(IVelk& velk, PluginConfig& config)
@@ -21,31 +23,149 @@ ReturnValue AnimatorPlugin::initialize(IVelk& velk, PluginConfig& config)
     }
     auto& types = velk.type_registry();
     types.register_type<ext::AnyValue<KeyframeEntry>>();
-    types.register_interpolator<float>(&detail::typed_interpolator<float>);
-    types.register_interpolator<double>(&detail::typed_interpolator<double>);
-    types.register_interpolator<uint8_t>(&detail::typed_interpolator<uint8_t>);
-    types.register_interpolator<uint16_t>(&detail::typed_interpolator<uint16_t>);
-    types.register_interpolator<uint32_t>(&detail::typed_interpolator<uint32_t>);
-    types.register_interpolator<uint64_t>(&detail::typed_interpolator<uint64_t>);
-    types.register_interpolator<int8_t>(&detail::typed_interpolator<int8_t>);
-    types.register_interpolator<int16_t>(&detail::typed_interpolator<int16_t>);
-    types.register_interpolator<int32_t>(&detail::typed_interpolator<int32_t>);
-    types.register_interpolator<int64_t>(&detail::typed_interpolator<int64_t>);
+    register_typed_interpolator<float>(types);
+    register_typed_interpolator<double>(types);
+    register_typed_interpolator<uint8_t>(types);
+    register_typed_interpolator<uint16_t>(types);
+    register_typed_interpolator<uint32_t>(types);
+    register_typed_interpolator<uint64_t>(types);
+    register_typed_interpolator<int8_t>(types);
+    register_typed_interpolator<int16_t>(types);
+    register_typed_interpolator<int32_t>(types);
+    register_typed_interpolator<int64_t>(types);
 
     animator_ = velk.create<IAnimator>(ClassId::Animator);
+    add_animator(animator_, 0);
     velk_ = &velk;
     return ReturnValue::Success;
 }
 
 ReturnValue AnimatorPlugin::shutdown(IVelk&)
 {
+    for (auto* list : {&scheduled_, &parked_}) {
+        for (auto& s : *list) {
+            auto animator = s.animator.lock();
+            if (auto* sched = interface_cast<IScheduledAnimator>(animator)) {
+                sched->set_scheduler(nullptr);
+            }
+        }
+        list->clear();
+    }
     return ReturnValue::Success;
 }
 
+void AnimatorPlugin::add_animator(const IAnimator::Ptr& animator, int32_t priority)
+{
+    if (!animator) {
+        return;
+    }
+    remove_animator(animator);
+    Scheduled s;
+    s.animator = animator;
+    s.raw = animator.get();
+    s.priority = priority;
+    s.order = nextOrder_++;
+    if (auto* sched = interface_cast<IScheduledAnimator>(animator)) {
+        sched->set_scheduler(this);
+    }
+    if (animator->is_paused()) {
+        parked_.push_back(std::move(s));
+    } else {
+        schedule(std::move(s));
+    }
+}
+
+void AnimatorPlugin::remove_animator(const IAnimator::Ptr& animator)
+{
+    Scheduled s;
+    if (animator && (take(scheduled_, animator.get(), s) || take(parked_, animator.get(), s))) {
+        if (auto* sched = interface_cast<IScheduledAnimator>(animator)) {
+            sched->set_scheduler(nullptr);
+        }
+    }
+}
+
+void AnimatorPlugin::on_paused_changed(IAnimator& animator, bool paused)
+{
+    Scheduled s;
+    if (paused) {
+        if (take(scheduled_, &animator, s)) {
+            // Paused time is not caught up, so neither is the time of a deferred update
+            s.owed = {};
+            s.deferred = false;
+            parked_.push_back(std::move(s));
+        }
+    } else if (take(parked_, &animator, s)) {
+        schedule(std::move(s));
+    }
+    // Drop the entries of paused animators that were destroyed
+    for (size_t i = 0; i < parked_.size();) {
+        if (parked_[i].animator.expired()) {
+            parked_.erase(parked_.begin() + static_cast<ptrdiff_t>(i));
+        } else {
+            ++i;
+        }
+    }
+}
+
+void AnimatorPlugin::schedule(Scheduled&& s)
+{
+    size_t pos = 0;
+    while (pos < scheduled_.size() && (scheduled_[pos].priority > s.priority ||
+                                       (scheduled_[pos].priority == s.priority && scheduled_[pos].order < s.order))) {
+        ++pos;
+    }
+    scheduled_.insert(scheduled_.begin() + static_cast<ptrdiff_t>(pos), std::move(s));
+}
+
+bool AnimatorPlugin::take(vector<Scheduled>& list, IAnimator* raw, Scheduled& out)
+{
+    for (size_t i = 0; i < list.size(); ++i) {
+        if (list[i].raw == raw) {
+            out = std::move(list[i]);
+            list.erase(list.begin() + static_cast<ptrdiff_t>(i));
+            return true;
+        }
+    }
+    return false;
+}
+
 void AnimatorPlugin::pre_update(const IPlugin::PreUpdateInfo& info)
 {
-    if (auto* a = interface_cast<IAnimator>(animator_)) {
-        a->tick(info.info);
+    using clock = std::chrono::steady_clock;
+    auto start = budget_.us > 0 ? clock::now() : clock::time_point{};
+    bool overBudget = false;
+    for (size_t i = 0; i < scheduled_.size();) {
+        auto& s = scheduled_[i];
+        auto animator = s.animator.lock();
+        if (!animator) {
+            scheduled_.erase(scheduled_.begin() + static_cast<ptrdiff_t>(i));
+            continue;
+        }
+        ++i;
+        if (overBudget && !s.deferred) {
+            s.owed.us += info.info.dt.us;
+            s.deferred = true;
+            continue;
+        }
+        UpdateInfo update = info.info;
+        update.dt.us += s.owed.us;
+        s.owed = {};
+        s.deferred = false;
+        auto* raw = s.raw;
+        animator->tick(update);
+        if (scheduled_.size() < i || scheduled_[i - 1].raw != raw) {
+            // The tick added or removed animators, continue after the one that was ticked
+            size_t at = 0;
+            while (at < scheduled_.size() && scheduled_[at].raw != raw) {
+                ++at;
+            }
+            i = at < scheduled_.size() ? at + 1 : i - 1;
+        }
+        if (budget_.us > 0 && !overBudget) {
+            auto spent = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start);
+            overBudget = spent.count() >= budget_.us;
+        }
     }
 }
 
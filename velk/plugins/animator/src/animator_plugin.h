@@ -8,10 +8,17 @@
 #include <velk/ext/plugin.h>
 #include <velk/plugins/animator/interface/intf_animator_plugin.h>
 #include <velk/plugins/animator/interpolator_traits.h>
+#include <velk/vector.h>
 
 namespace velk {
 
-class AnimatorPlugin final : public ext::Plugin<AnimatorPlugin, IAnimatorPlugin>
+/**
+ * @brief Animator plugin: registers the animation types and ticks the scheduled animators.
+ *
+ * Paused animators are moved from scheduled_ to parked_ and back when they resume, so a
+ * paused animator costs nothing per update.
+ */
+class AnimatorPlugin final : public ext::Plugin<AnimatorPlugin, IAnimatorPlugin>, public IAnimatorScheduler
 {
 public:
     VELK_PLUGIN_UID("738617b8-dba8-4a08-a0bc-51e8dc4d5faf");
@@ -23,9 +30,35 @@ public:
     void pre_update(const IPlugin::PreUpdateInfo& info) override;
 
     IAnimator& get_default_animator() const override { return *animator_; }
+    void add_animator(const IAnimator::Ptr& animator, int32_t priority) override;
+    void remove_animator(const IAnimator::Ptr& animator) override;
+    void set_frame_budget(Duration budget) override { budget_ = budget; }
+    Duration get_frame_budget() const override { return budget_; }
+
+    void on_paused_changed(IAnimator& animator, bool paused) override;
 
 private:
+    /** @brief An animator ticked by pre_update(). */
+    struct Scheduled
+    {
+        IAnimator::WeakPtr animator;
+        IAnimator* raw = nullptr; ///< For lookups, not dereferenced.
+        int32_t priority = 0;
+        uint64_t order = 0;       ///< Insertion order among animators of equal priority.
+        Duration owed{};          ///< Time of the updates the animator was deferred from.
+        bool deferred = false;
+    };
+
+    /** @brief Inserts @p s into scheduled_ after all animators of higher or equal rank. */
+    void schedule(Scheduled&& s);
+    /** @brief Removes the entry of @p raw from @p list into @p out. Returns false if not found. */
+    static bool take(vector<Scheduled>& list, IAnimator* raw, Scheduled& out);
+
     IAnimator::Ptr animator_;
+    vector<Scheduled> scheduled_; ///< Ticked animators, sorted by descending priority, then order.
+    vector<Scheduled> parked_;    ///< Paused animators, not ticked until they resume.
+    uint64_t nextOrder_ = 0;
+    Duration budget_{};
     IVelk* velk_ = nullptr;
 };
 
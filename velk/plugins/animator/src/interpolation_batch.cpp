@@ -0,0 +1,171 @@
+#include "interpolation_batch.h"
+
+#include <cstring>
+
+namespace velk {
+
+namespace {
+
+/** @brief Returns the lane handle of @p lane in group @p group. */
+uint32_t make_handle(size_t group, size_t lane)
+{
+    return static_cast<uint32_t>(group << 24 | lane);
+}
+
+constexpr uint32_t lane_mask = (1u << 24) - 1;
+
+template <size_t Size>
+void write_results(const unsigned char* result, void* const* target, const uint32_t* source, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        std::memcpy(target[i], result + source[i] * Size, Size);
+    }
+}
+
+} // namespace
+
+void InterpolationBatch::Group::evaluate()
+{
+    size_t n = t.size();
+    if (!n) {
+        return;
+    }
+    result.resize(n * size);
+    bulk(from.data(), to.data(), t.data(), result.data(), n);
+
+    // Fixed-size copies for the common scalar sizes
+    switch (size) {
+    case 1: write_results<1>(result.data(), target.data(), source.data(), target.size()); break;
+    case 2: write_results<2>(result.data(), target.data(), source.data(), target.size()); break;
+    case 4: write_results<4>(result.data(), target.data(), source.data(), target.size()); break;
+    case 8: write_results<8>(result.data(), target.data(), source.data(), target.size()); break;
+    default:
+        for (size_t i = 0; i < target.size(); ++i) {
+            std::memcpy(target[i], result.data() + source[i] * size, size);
+        }
+        break;
+    }
+}
+
+void InterpolationBatch::Group::clear()
+{
+    from.clear();
+    to.clear();
+    t.clear();
+    easing.clear();
+    result.clear();
+    target.clear();
+    source.clear();
+}
+
+uint32_t InterpolationBatch::add_lane(BulkInterpolatorFn bulk, size_t size, const void* from, const void* to,
+                                      float t, easing::EasingFn easing)
+{
+    if (last_ >= groups_.size() || groups_[last_].bulk != bulk || groups_[last_].size != size) {
+        last_ = 0;
+        while (last_ < groups_.size() && (groups_[last_].bulk != bulk || groups_[last_].size != size)) {
+            ++last_;
+        }
+        if (last_ == groups_.size()) {
+            auto& group = groups_.emplace_back();
+            group.bulk = bulk;
+            group.size = size;
+        }
+    }
+    auto& g = groups_[last_];
+    size_t lane = g.t.size();
+    g.from.resize((lane + 1) * size);
+    g.to.resize((lane + 1) * size);
+    std::memcpy(g.from.data() + lane * size, from, size);
+    std::memcpy(g.to.data() + lane * size, to, size);
+    g.t.push_back(t);
+    g.easing.push_back(easing ? easing : easing::linear);
+    return make_handle(last_, lane);
+}
+
+void InterpolationBatch::add_write(uint32_t lane, void* target)
+{
+    auto& g = groups_[lane >> 24];
+    g.target.push_back(target);
+    g.source.push_back(lane & lane_mask);
+}
+
+void InterpolationBatch::ease(Group& group)
+{
+    // Lanes of one animation, and often of many, share their easing. Each run of equal
+    // easings is eased with one bulk kernel call instead of an indirect call per lane.
+    float* t = group.t.data();
+    const easing::EasingFn* fn = group.easing.data();
+    size_t n = group.t.size();
+    for (size_t begin = 0; begin < n;) {
+        size_t end = begin + 1;
+        while (end < n && fn[end] == fn[begin]) {
+            ++end;
+        }
+        switch (auto id = easing::easing_id(fn[begin])) {
+        case easing::EasingId::Linear: break;
+        case easing::EasingId::Custom: ease_custom(fn[begin], t + begin, end - begin); break;
+        default: easing::bulk_easing(id)(t + begin, t + begin, end - begin); break;
+        }
+        begin = end;
+    }
+}
+
+void InterpolationBatch::ease_custom(easing::EasingFn fn, float* t, size_t n)
+{
+    if (!lutSize_) {
+        for (size_t i = 0; i < n; ++i) {
+            t[i] = fn(t[i]);
+        }
+        return;
+    }
+    Lut* lut = nullptr;
+    for (auto& l : luts_) {
+        if (l.fn == fn) {
+            lut = &l;
+            break;
+        }
+    }
+    if (!lut) {
+        lut = &luts_.emplace_back();
+        lut->fn = fn;
+        lut->lut = easing::EasingLut(fn, lutSize_);
+    }
+    lut->lut.evaluate(t, t, n);
+}
+
+void InterpolationBatch::set_easing_lut_size(size_t size)
+{
+    if (size != lutSize_) {
+        lutSize_ = size;
+        luts_.clear();
+    }
+}
+
+void InterpolationBatch::evaluate()
+{
+    for (auto& g : groups_) {
+        ease(g);
+        g.evaluate();
+    }
+}
+
+void InterpolationBatch::clear()
+{
+    // Groups are kept, so their arrays keep their capacity for the next tick
+    for (auto& g : groups_) {
+        g.clear();
+    }
+    last_ = 0;
+}
+
+size_t InterpolationBatch::size() const
+{
+    size_t n = 0;
+    for (auto& g : groups_) {
+        n += g.t.size();
+    }
+    return n;
+}
+
+} // namespace velk
@@ -0,0 +1,126 @@
+#ifndef VELK_ANIMATOR_INTERPOLATION_BATCH_H
+#define VELK_ANIMATOR_INTERPOLATION_BATCH_H
+
+#include <velk/interface/intf_type_registry.h>
+#include <velk/plugins/animator/easing.h>
+#include <velk/plugins/animator/easing_bulk.h>
+#include <velk/plugins/animator/interface/intf_animation.h>
+#include <velk/vector.h>
+
+#include <cstdint>
+
+namespace velk {
+
+/**
+ * @brief Structure-of-arrays evaluator for animated values.
+ *
+ * Each lane interpolates one value: from, to, progress t and easing are stored in dense
+ * arrays, grouped by the bulk interpolator of the value type. evaluate() eases every lane
+ * (built-in easings with their bulk kernel, once per run of lanes that share the easing),
+ * runs each group's BulkInterpolatorFn once over its arrays and writes the results directly
+ * to the registered target storage (State members, display buffers). The batch is refilled
+ * every tick; clear() keeps the capacity.
+ */
+class InterpolationBatch
+{
+public:
+    /** @brief Largest value size (in bytes) that can be batched. */
+    static constexpr size_t max_value_size = 16;
+
+    /**
+     * @brief Adds a lane and returns its handle.
+     * @param bulk Bulk interpolator of the value type.
+     * @param size Size of the value type in bytes, at most max_value_size.
+     * @param from Value at t = 0.
+     * @param to Value at t = 1.
+     * @param t Uneased progress.
+     * @param easing Easing applied to @p t by evaluate(). nullptr means linear.
+     */
+    uint32_t add_lane(BulkInterpolatorFn bulk, size_t size, const void* from, const void* to, float t,
+                      easing::EasingFn easing);
+    /** @brief Makes evaluate() write the result of @p lane to @p target. */
+    void add_write(uint32_t lane, void* target);
+    /** @brief Evaluates all lanes and writes the results to their targets. */
+    void evaluate();
+    /** @brief Removes all lanes and writes. */
+    void clear();
+    /** @brief Returns the number of lanes. */
+    size_t size() const;
+    /**
+     * @brief Evaluates custom easing functions through an easing::EasingLut of @p size samples.
+     * @param size 0 (the default) calls the functions for every lane.
+     */
+    void set_easing_lut_size(size_t size);
+
+private:
+    /** @brief Lanes of one value type. */
+    struct Group
+    {
+        BulkInterpolatorFn bulk{};
+        size_t size{};
+        vector<unsigned char> from;
+        vector<unsigned char> to;
+        vector<float> t;
+        vector<easing::EasingFn> easing;
+        vector<unsigned char> result;
+        vector<void*> target;
+        vector<uint32_t> source; ///< Lane index (within the group) of each target.
+
+        void evaluate();
+        void clear();
+    };
+
+    /** @brief Lookup table of a custom easing function. */
+    struct Lut
+    {
+        easing::EasingFn fn{};
+        easing::EasingLut lut;
+    };
+
+    /** @brief Replaces the t of @p group by their eased values. */
+    void ease(Group& group);
+    /** @brief Eases @p n values of @p t with a custom easing function. */
+    void ease_custom(easing::EasingFn fn, float* t, size_t n);
+
+    vector<Group> groups_;
+    size_t last_{}; ///< Group of the previous add_lane(), checked first.
+    vector<Lut> luts_;
+    size_t lutSize_{};
+};
+
+/**
+ * @brief Plugin-internal interface for animations that can feed an InterpolationBatch.
+ *
+ * The animator ticks these in three phases: prepare_batched() resolves everything that
+ * touches shared state on the calling thread, tick_batched() advances time and adds lanes
+ * (possibly on a worker thread), and after the batch has been evaluated commit_batch()
+ * fires the notifications for the written values.
+ */
+class IBatchedAnimation : public Interface<IBatchedAnimation>
+{
+public:
+    /**
+     * @brief Prepares the next tick_batched() call. Called on the thread that ticks the animator.
+     * @param targets Receives the storage the animation writes through the batch, other than
+     *        its own buffers. Animations that share a target are evaluated in one partition.
+     * @return false if the animation cannot be batched, in which case IAnimation::tick()
+     *         must be called instead of tick_batched().
+     */
+    virtual bool prepare_batched(vector<void*>& targets) = 0;
+    /**
+     * @brief Advances the animation by adding its values to @p batch.
+     *
+     * Must not touch anything outside the animation and the targets reported by
+     * prepare_batched(), since animations in other partitions run concurrently.
+     * @return true if the animation was advanced and commit_batch() must be called after
+     *         evaluation. false if nothing was changed, in which case IAnimation::tick()
+     *         must be called.
+     */
+    virtual bool tick_batched(const UpdateInfo& info, InterpolationBatch& batch) = 0;
+    /** @brief Notifies about the values written by the last evaluated batch. */
+    virtual void commit_batch() = 0;
+};
+
+} // namespace velk
+
+#endif // VELK_ANIMATOR_INTERPOLATION_BATCH_H
@@ -5,6 +5,7 @@
 #include <velk/plugins/animator/interface/intf_animator_plugin.h>
 
 #include <algorithm>
+#include <cstring>
 
 namespace velk {
 
@@ -14,27 +15,21 @@ namespace velk {
 
 void TransitionDriver::init(const IAny& inner)
 {
-    display = inner.clone();
-    from = inner.clone();
-    target = inner.clone();
-    result = inner.clone();
+    display.assign(inner);
+    from = display;
+    target = display;
+    result = display;
 }
 
 bool TransitionDriver::start(const void* data, size_t size, Uid type)
 {
-    if (!display) {
+    if (display.empty()) {
         return false;
     }
 
-    // Capture from = current display value
-    if (from) {
-        from->copy_from(*display);
-    }
-
-    // Capture target = new value
-    if (target) {
-        target->set_data(data, size, type);
-    }
+    // Capture from = current display value, target = new value
+    from.copy_from(display);
+    target.set_data(data, size, type);
 
     // Reset animation
     elapsed = {};
@@ -44,16 +39,12 @@ bool TransitionDriver::start(const void* data, size_t size, Uid type)
 
 bool TransitionDriver::start_from(const IAny& value)
 {
-    if (!display) {
+    if (display.empty()) {
         return false;
     }
 
-    if (from) {
-        from->copy_from(*display);
-    }
-    if (target) {
-        target->copy_from(value);
-    }
+    from.copy_from(display);
+    target.copy_from(value);
 
     elapsed = {};
     animating = true;
@@ -67,6 +58,27 @@ bool TransitionDriver::tick(Duration dt, Duration duration, easing::EasingFn eas
         return false;
     }
 
+    float t = advance(dt, duration);
+    float eased = easing ? easing(t) : t;
+
+    if (interpolator && from && target && result) {
+        if (succeeded(interpolator(from, target, eased, result))) {
+            display.copy_from(result);
+            inner.copy_from(result);
+        }
+    }
+
+    notify_changed(owner);
+
+    if (t >= 1.f) {
+        animating = false;
+    }
+
+    return animating;
+}
+
+float TransitionDriver::advance(Duration dt, Duration duration)
+{
     elapsed.us += dt.us;
 
     float t = 1.f;
@@ -74,38 +86,27 @@ bool TransitionDriver::tick(Duration dt, Duration duration, easing::EasingFn eas
         t = static_cast<float>(elapsed.us) / static_cast<float>(duration.us);
         t = std::min(t, 1.f);
     }
+    return t;
+}
 
-    float eased = easing ? easing(t) : t;
-
-    if (interpolator && from && target && result) {
-        if (succeeded(interpolator(*from, *target, eased, *result))) {
-            display->copy_from(*result);
-            inner.copy_from(*result);
-        }
-    }
-
+void TransitionDriver::notify_changed(const IInterface::WeakPtr& owner)
+{
     // Fire on_changed on the property
     auto prop = owner.lock();
     if (prop) {
         auto* propIntf = interface_cast<IProperty>(prop);
         if (propIntf && propIntf->on_changed()) {
-            invoke_event(propIntf->on_changed(), display.get());
+            invoke_event(propIntf->on_changed(), &display);
         }
     }
-
-    if (t >= 1.f) {
-        animating = false;
-    }
-
-    return animating;
 }
 
 void TransitionDriver::clear()
 {
-    display = nullptr;
-    from = nullptr;
-    target = nullptr;
-    result = nullptr;
+    display.reset();
+    from.reset();
+    target.reset();
+    result.reset();
     elapsed = {};
     animating = false;
 }
@@ -126,11 +127,18 @@ void TransitionProxy::set_inner(IAny::Ptr inner, const IInterface::WeakPtr& owne
     // Resolve interpolator from the inner's compatible type
     auto types = inner_->get_compatible_types();
     if (!types.empty()) {
-        interpolator_ = instance().type_registry().find_interpolator(types[0]);
+        auto& registry = instance().type_registry();
+        type_ = types[0];
+        size_ = inner_->get_data_size(type_);
+        interpolator_ = registry.find_interpolator(type_);
+        bulk_ = registry.find_bulk_interpolator(type_);
     }
 
     driver.init(*inner_);
-    pending_ = inner_->clone();
+    inlinePending_ = size_ && size_ <= sizeof(pendingWords_) && driver.display.get_data_pointer(type_);
+    if (!inlinePending_) {
+        pending_ = driver.display;
+    }
 }
 
 IAny::Ptr TransitionProxy::take_inner(IInterface&)
@@ -138,24 +146,27 @@ IAny::Ptr TransitionProxy::take_inner(IInterface&)
     owner_ = IInterface::WeakPtr{};
     parent_ = nullptr;
     active_flag_ = nullptr;
+    link_ = nullptr;
     driver.clear();
-    pending_ = nullptr;
+    pending_.reset();
+    inlinePending_ = false;
     has_pending_.store(false, std::memory_order_relaxed);
     interpolator_ = nullptr;
+    bulk_ = nullptr;
     return std::move(inner_);
 }
 
 ReturnValue TransitionProxy::get_data(void* to, size_t toSize, Uid type) const
 {
-    return driver.display ? driver.display->get_data(to, toSize, type) : ReturnValue::Fail;
+    return driver.display.get_data(to, toSize, type);
 }
 
 ReturnValue TransitionProxy::set_data(void const* from, size_t size, Uid type)
 {
-    if (!driver.display || !interpolator_) {
+    if (driver.display.empty() || !interpolator_) {
         // No interpolator: fall through to direct write
-        if (driver.display) {
-            auto ret = driver.display->set_data(from, size, type);
+        if (!driver.display.empty()) {
+            auto ret = driver.display.set_data(from, size, type);
             if (inner_ && ret == ReturnValue::Success) {
                 inner_->set_data(from, size, type);
             }
@@ -168,23 +179,21 @@ ReturnValue TransitionProxy::set_data(void const* from, size_t size, Uid type)
     // driver.start() mutates shared driver state (from, target, elapsed) that tick()
     // reads on the update thread. Writing to the pending buffer here and letting tick()
     // call driver.start() serializes all driver mutation onto the update thread.
-    if (pending_) {
-        pending_->set_data(from, size, type);
-    }
-    has_pending_.store(true, std::memory_order_release);
+    stash_pending(from, size, type);
     if (active_flag_) {
         active_flag_->store(true, std::memory_order_release);
     }
+    if (link_) {
+        link_->report_active(true);
+        link_->wake();
+    }
     return ReturnValue::NothingToDo;
 }
 
 ReturnValue TransitionProxy::copy_from(const IAny& other)
 {
     // Passthrough: used by deferred flush (set_value_silent path).
-    ReturnValue ret = ReturnValue::Fail;
-    if (driver.display) {
-        ret = driver.display->copy_from(other);
-    }
+    ReturnValue ret = driver.display.empty() ? ReturnValue::Fail : driver.display.copy_from(other);
     if (inner_ && succeeded(ret)) {
         inner_->copy_from(other);
     }
@@ -193,31 +202,129 @@ ReturnValue TransitionProxy::copy_from(const IAny& other)
 
 IAny::Ptr TransitionProxy::clone() const
 {
-    return driver.display ? driver.display->clone() : nullptr;
+    return driver.display.clone();
 }
 
-bool TransitionProxy::tick(Duration dt, Duration duration, easing::EasingFn easing)
+ReturnValue TransitionProxy::clone_into(AnyBuffer& buffer) const
 {
-    if (!inner_) {
-        return false;
+    return driver.display.clone_into(buffer);
+}
+
+uint32_t TransitionProxy::lock_pending()
+{
+    uint32_t seq = pendingSeq_.load(std::memory_order_relaxed);
+    for (;;) {
+        if (!(seq & 1) &&
+            pendingSeq_.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return seq;
+        }
+        if (seq & 1) {
+            seq = pendingSeq_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void TransitionProxy::stash_pending(const void* data, size_t size, Uid type)
+{
+    if (!inlinePending_) {
+        // The buffer is not atomic: the reader holds the sequence as well while it copies out
+        uint32_t seq = lock_pending();
+        pending_.set_data(data, size, type);
+        unlock_pending(seq);
+        has_pending_.store(true, std::memory_order_release);
+        return;
+    }
+    if (type != type_ || size != size_) {
+        return;
+    }
+    uint64_t words[pending_words] = {};
+    std::memcpy(words, data, size);
+
+    // Writers exclude each other by making the sequence odd
+    uint32_t seq = lock_pending();
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < pending_words; ++i) {
+        pendingWords_[i].store(words[i], std::memory_order_relaxed);
     }
+    unlock_pending(seq);
+    has_pending_.store(true, std::memory_order_release);
+}
 
+void TransitionProxy::take_pending()
+{
     // Consume pending target stashed by set_data() (possibly from another thread).
     // This is the only place driver.start() is called, ensuring all driver mutation
     // happens on the update thread.
-    if (has_pending_.exchange(false, std::memory_order_acquire) && pending_) {
-        driver.start_from(*pending_);
+    if (!has_pending_.exchange(false, std::memory_order_acquire)) {
+        return;
+    }
+    if (!inlinePending_) {
+        // start_from() only copies the value, so the writers do not wait long
+        uint32_t seq = lock_pending();
+        if (pending_) {
+            driver.start_from(pending_);
+        }
+        unlock_pending(seq);
+        return;
+    }
+    uint64_t words[pending_words];
+    uint32_t before;
+    uint32_t after;
+    do {
+        before = pendingSeq_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < pending_words; ++i) {
+            words[i] = pendingWords_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = pendingSeq_.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+    driver.start(words, size_, type_);
+}
+
+bool TransitionProxy::tick(Duration dt, Duration duration, easing::EasingFn easing)
+{
+    if (!inner_) {
+        return false;
     }
 
+    take_pending();
     return driver.tick(dt, duration, easing, interpolator_, *inner_, owner_);
 }
 
+bool TransitionProxy::can_batch()
+{
+    return inner_ && bulk_ && interpolator_ && size_ <= InterpolationBatch::max_value_size &&
+           driver.from.get_data_pointer(type_) && driver.target.get_data_pointer(type_) &&
+           driver.display.get_data_pointer(type_) && inner_->get_data_pointer(type_);
+}
+
+bool TransitionProxy::tick_batched(Duration dt, Duration duration, easing::EasingFn easing,
+                                   InterpolationBatch& batch)
+{
+    take_pending();
+    if (!driver.animating) {
+        return false;
+    }
+
+    float t = driver.advance(dt, duration);
+    auto lane = batch.add_lane(bulk_, size_, driver.from.get_data_pointer(type_),
+                               driver.target.get_data_pointer(type_), t, easing);
+    batch.add_write(lane, driver.display.get_data_pointer(type_));
+    batch.add_write(lane, batch_target());
+    if (t >= 1.f) {
+        driver.animating = false;
+    }
+    return true;
+}
+
 // ============================================================================
 // TransitionImpl
 // ============================================================================
 
 TransitionImpl::~TransitionImpl()
 {
+    // First, so that a tick on another thread is done with this animation
+    link_.unlink();
     if (transient_) {
         TransitionImpl::uninstall();
     }
@@ -264,13 +371,39 @@ bool TransitionImpl::is_active() const
 
 void TransitionImpl::ensure_registered()
 {
-    if (!registered_) {
+    if (registered_) {
+        return;
+    }
+    auto animator = animator_.lock();
+    if (!animator) {
         auto* ap = get_or_load_plugin<IAnimatorPlugin>(PluginId::AnimatorPlugin);
-        if (ap) {
-            ap->get_default_animator().add(get_self<IAnimation>());
-            registered_ = true;
+        if (!ap) {
+            return;
+        }
+        animator = ::velk::get_self<IAnimator>(&ap->get_default_animator());
+    }
+    if (animator) {
+        animator->add(get_self<IAnimation>());
+        registeredTo_ = animator;
+        registered_ = true;
+    }
+}
+
+void TransitionImpl::set_animator(const IAnimator::Ptr& animator)
+{
+    animator_ = animator;
+    if (!registered_) {
+        return;
+    }
+    if (auto current = registeredTo_.lock()) {
+        if (current == animator) {
+            return;
         }
+        current->remove(get_self<IAnimation>());
     }
+    registeredTo_ = IAnimator::WeakPtr{};
+    registered_ = false;
+    ensure_registered(); // Joins the active list of the new animator
 }
 
 ITransition::State* TransitionImpl::state()
@@ -301,6 +434,7 @@ TransitionImpl::ChildEntry TransitionImpl::make_proxy()
         p->parent_ = get_self<IInterface>();
     }
     p->active_flag_ = &active_;
+    p->link_ = &link_;
     return {{}, ext, p};
 }
 
@@ -404,6 +538,11 @@ IAny::Ptr TransitionImpl::clone() const
     return installed_proxy_ ? installed_proxy_->clone() : nullptr;
 }
 
+ReturnValue TransitionImpl::clone_into(AnyBuffer& buffer) const
+{
+    return installed_proxy_ ? installed_proxy_->clone_into(buffer) : ReturnValue::Fail;
+}
+
 // ITransition
 
 ReturnValue TransitionImpl::tick(const UpdateInfo& info)
@@ -424,14 +563,75 @@ ReturnValue TransitionImpl::tick(const UpdateInfo& info)
         }
     }
     active_.store(anyAnimating, std::memory_order_relaxed);
+    update_animating(anyAnimating);
 
+    return anyAnimating ? ReturnValue::Success : ReturnValue::NothingToDo;
+}
+
+void TransitionImpl::update_animating(bool anyAnimating)
+{
+    link_.report_active(active_.load(std::memory_order_acquire));
     // Update observable animating state if it changed
+    auto* s = state();
     if (s && s->animating != anyAnimating) {
         s->animating = anyAnimating;
         notify_state();
     }
+}
 
-    return anyAnimating ? ReturnValue::Success : ReturnValue::NothingToDo;
+// IBatchedAnimation
+
+bool TransitionImpl::prepare_batched(vector<void*>& targets)
+{
+    if (!active_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    // All children are batched, or none: a mix would notify in a different order than tick()
+    for (auto& child : children_) {
+        if (child.proxy && !child.proxy->can_batch()) {
+            return false;
+        }
+    }
+    for (auto& child : children_) {
+        if (child.proxy) {
+            targets.push_back(child.proxy->batch_target());
+        }
+    }
+    return true;
+}
+
+bool TransitionImpl::tick_batched(const UpdateInfo& info, InterpolationBatch& batch)
+{
+    if (!active_.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    auto* s = state();
+    Duration duration = s ? s->duration : Duration{};
+    bool anyAnimating = false;
+    for (auto& child : children_) {
+        if (child.proxy) {
+            child.batched = child.proxy->tick_batched(info.dt, duration, easing_, batch);
+            anyAnimating = child.proxy->driver.animating || anyAnimating;
+        }
+    }
+    active_.store(anyAnimating, std::memory_order_relaxed);
+    return true;
+}
+
+void TransitionImpl::commit_batch()
+{
+    bool anyAnimating = false;
+    for (auto& child : children_) {
+        if (child.proxy) {
+            if (child.batched) {
+                child.batched = false;
+                child.proxy->driver.notify_changed(child.proxy->owner_);
+            }
+            anyAnimating = child.proxy->driver.animating || anyAnimating;
+        }
+    }
+    update_animating(anyAnimating);
 }
 
 } // namespace velk
@@ -1,8 +1,12 @@
 #ifndef VELK_ANIMATOR_TRANSITION_IMPL_H
 #define VELK_ANIMATOR_TRANSITION_IMPL_H
 
+#include "animation_registry.h"
+#include "interpolation_batch.h"
+
 #include <velk/ext/any_extension.h>
 #include <velk/ext/object.h>
+#include <velk/inline_any.h>
 #include <velk/plugins/animator/interface/intf_transition.h>
 #include <velk/plugins/animator/plugin.h>
 #include <velk/vector.h>
@@ -15,16 +19,17 @@ namespace velk {
  * @brief Per-property transition state and interpolation logic.
  *
  * Plain C++ struct that holds the animation buffers (display, from, target, result)
- * and manages interpolation. Used by both TransitionImpl (direct install) and
+ * and manages interpolation. The buffers are InlineAny, so trivially copyable values
+ * are held inline and starting a transition does not allocate. Used by both TransitionImpl (direct install) and
  * TransitionProxy (multi-target children).
  */
 struct TransitionDriver
 {
-    IAny::Ptr display, from, target, result;
+    InlineAny<> display, from, target, result;
     Duration elapsed{};
     bool animating = false;
 
-    /** @brief Clones all scratch buffers from an inner IAny. */
+    /** @brief Copies all scratch buffers from an inner IAny. */
     void init(const IAny& inner);
 
     /** @brief Captures from=display, target=new data, resets elapsed. Returns false if no display. */
@@ -40,6 +45,12 @@ struct TransitionDriver
     bool tick(Duration dt, Duration duration, easing::EasingFn easing, InterpolatorFn interpolator,
               IAny& inner, const IInterface::WeakPtr& owner);
 
+    /** @brief Advances elapsed by @p dt and returns the uneased progress, clamped to 1. */
+    float advance(Duration dt, Duration duration);
+
+    /** @brief Fires on_changed on the property @p owner with the display value. */
+    void notify_changed(const IInterface::WeakPtr& owner);
+
     /** @brief Resets all state. */
     void clear();
 };
@@ -69,24 +80,59 @@ public:
     ReturnValue set_data(void const* from, size_t size, Uid type) override;
     ReturnValue copy_from(const IAny& other) override;
     IAny::Ptr clone() const override;
+    ReturnValue clone_into(AnyBuffer& buffer) const override;
 
     /** @brief Ticks this proxy's driver with its own interpolator/inner/owner. */
     bool tick(Duration dt, Duration duration, easing::EasingFn easing);
 
+    /** @brief Returns true if tick_batched() can write the values of this proxy in place. */
+    bool can_batch();
+    /** @brief Returns the property storage tick_batched() writes to. Requires can_batch(). */
+    void* batch_target() { return inner_->get_data_pointer(type_); }
+
+    /**
+     * @brief Like tick(), but adds the interpolation to @p batch instead of running it.
+     * @return true if a lane was added, in which case driver.notify_changed() must be
+     *         called once the batch has been evaluated.
+     */
+    bool tick_batched(Duration dt, Duration duration, easing::EasingFn easing, InterpolationBatch& batch);
+
     IAny* inner_ptr() { return inner_.get(); }
 
     TransitionDriver driver;
     IInterface::WeakPtr owner_;
     InterpolatorFn interpolator_ = nullptr;
+    BulkInterpolatorFn bulk_ = nullptr;
+    Uid type_;        ///< Value type of the inner.
+    size_t size_ = 0; ///< Size of the value type.
     IInterface::Ptr parent_; ///< Strong ref to TransitionImpl when persistent (creates intentional cycle).
     std::atomic<bool>* active_flag_ = nullptr; ///< Points into TransitionImpl::active_; set on driver start.
+    RegistryLink* link_ = nullptr;             ///< Points to TransitionImpl::link_; woken on driver start.
 
     // Pending target stash: set_data() may be called from any thread, but driver.start()
     // mutates driver state (from, target, elapsed) which tick() also reads on the update
     // thread. To avoid a data race, set_data() stashes the new target value here and sets
     // has_pending_. The next tick() on the update thread picks it up and calls driver.start().
-    IAny::Ptr pending_;
+    // Values of up to pending_words * 8 bytes go through a seqlock over atomic words, so
+    // concurrent writers and the reader never touch the same non-atomic memory. Larger
+    // values use the pending_ buffer, which writers and the reader only touch while they
+    // hold pendingSeq_ odd, so there the sequence acts as a spin lock.
+    static constexpr size_t pending_words = 2;
+    InlineAny<> pending_;
+    std::atomic<uint64_t> pendingWords_[pending_words] = {};
+    std::atomic<uint32_t> pendingSeq_{0}; ///< Odd while the pending target is being stored (or read from pending_).
+    bool inlinePending_ = false;          ///< The value type fits in pendingWords_.
     std::atomic<bool> has_pending_{false};
+
+private:
+    /** @brief Stashes @p data as the next target. Called from set_data() on any thread. */
+    void stash_pending(const void* data, size_t size, Uid type);
+    /** @brief Starts the driver towards the stashed target, if any. Called on the update thread. */
+    void take_pending();
+    /** @brief Waits until pendingSeq_ is even and makes it odd. Returns the even value. */
+    uint32_t lock_pending();
+    /** @brief Ends lock_pending(), advancing pendingSeq_ to the next even value. */
+    void unlock_pending(uint32_t seq) { pendingSeq_.store(seq + 2, std::memory_order_release); }
 };
 
 /**
@@ -99,7 +145,8 @@ public:
  * is a lightweight TransitionProxy with the same duration/easing, installed on
  * its own property. Config changes propagate to all children.
  */
-class TransitionImpl final : public ext::Object<TransitionImpl, ITransition, IAnyExtension>
+class TransitionImpl final
+    : public ext::Object<TransitionImpl, ITransition, IAnyExtension, IBatchedAnimation, IRegistryMember>
 {
 public:
     VELK_CLASS_UID(ClassId::Transition);
@@ -115,6 +162,7 @@ public:
 
     // ITransition
     void set_easing(easing::EasingFn easing) override;
+    void set_animator(const IAnimator::Ptr& animator) override;
 
     // IAnyExtension: installing on a property creates a proxy child
     IAny::ConstPtr get_inner() const override;
@@ -128,6 +176,16 @@ public:
     ReturnValue set_data(void const* from, size_t fromSize, Uid type) override;
     ReturnValue copy_from(const IAny& other) override;
     IAny::Ptr clone() const override;
+    ReturnValue clone_into(AnyBuffer& buffer) const override;
+    void* get_data_pointer(Uid) override { return nullptr; }
+
+    // IBatchedAnimation
+    bool prepare_batched(vector<void*>& targets) override;
+    bool tick_batched(const UpdateInfo& info, InterpolationBatch& batch) override;
+    void commit_batch() override;
+
+    // IRegistryMember
+    RegistryLink& registry_link() override { return link_; }
 
 private:
     struct ChildEntry
@@ -135,6 +193,7 @@ private:
         IProperty::WeakPtr property;
         IAnyExtension::Ptr extension; ///< Strong ref for install/remove_extension.
         TransitionProxy* proxy;       ///< Typed pointer into extension.
+        bool batched = false;         ///< A lane was added in tick_batched(), notify in commit_batch().
     };
 
     ChildEntry make_proxy();
@@ -142,6 +201,7 @@ private:
     ITransition::State* state();
     const ITransition::State* state() const;
     void notify_state();
+    void update_animating(bool anyAnimating);
 
     easing::EasingFn easing_ = easing::linear;
     vector<ChildEntry> children_;
@@ -149,6 +209,9 @@ private:
     std::atomic<bool> active_{false};
     bool registered_ = false;
     bool transient_ = false;
+    IAnimator::WeakPtr animator_;     ///< Animator chosen with set_animator(), empty for the default.
+    IAnimator::WeakPtr registeredTo_; ///< Animator the transition was added to.
+    RegistryLink link_;
 };
 
 } // namespace velk
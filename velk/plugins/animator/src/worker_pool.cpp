@@ -0,0 +1,92 @@
+#include "worker_pool.h"
+
+namespace velk {
+
+WorkerPool::~WorkerPool()
+{
+    stop();
+}
+
+void WorkerPool::set_thread_count(size_t threads)
+{
+    size_t workers = threads > 1 ? threads - 1 : 0;
+    if (workers == threads_.size()) {
+        return;
+    }
+    stop();
+    stopping_ = false;
+    threads_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        threads_.emplace_back([this] { worker_main(); });
+    }
+}
+
+void WorkerPool::run(size_t count, TaskFn fn, void* context)
+{
+    if (!count) {
+        return;
+    }
+    if (threads_.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(context, i);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_ = fn;
+        context_ = context;
+        count_ = count;
+        next_.store(0, std::memory_order_relaxed);
+        busy_ = threads_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+    drain();
+    // The mutex hand-off also makes the workers' writes visible to the caller
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return busy_ == 0; });
+}
+
+void WorkerPool::worker_main()
+{
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+        }
+        drain();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--busy_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
+
+void WorkerPool::drain()
+{
+    for (size_t i = next_.fetch_add(1, std::memory_order_relaxed); i < count_;
+         i = next_.fetch_add(1, std::memory_order_relaxed)) {
+        fn_(context_, i);
+    }
+}
+
+void WorkerPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : threads_) {
+        t.join();
+    }
+    threads_.clear();
+}
+
+} // namespace velk
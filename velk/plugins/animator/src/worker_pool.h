@@ -0,0 +1,65 @@
+#ifndef VELK_ANIMATOR_WORKER_POOL_H
+#define VELK_ANIMATOR_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace velk {
+
+/**
+ * @brief Fixed set of worker threads that run indexed tasks for a blocking caller.
+ *
+ * run() hands out task indices to the workers and to the calling thread, and returns once
+ * every task has finished. Workers sleep between runs. The pool is not reentrant: run()
+ * must only be called from one thread at a time.
+ */
+class WorkerPool
+{
+public:
+    /** @brief Task callback, called once for every index in [0, count). */
+    using TaskFn = void (*)(void* context, size_t index);
+
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Sets the number of threads that run tasks, including the calling thread.
+     * @param threads 0 and 1 both mean that run() executes all tasks on the caller.
+     */
+    void set_thread_count(size_t threads);
+    /** @brief Returns the number of threads that run tasks, including the calling thread. */
+    size_t thread_count() const { return threads_.size() + 1; }
+    /** @brief Runs fn(context, i) for every i in [0, count) and waits for all of them. */
+    void run(size_t count, TaskFn fn, void* context);
+
+private:
+    void worker_main();
+    /** @brief Runs tasks of the current job until none are left. */
+    void drain();
+    void stop();
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_{}; ///< Incremented for every run(), guarded by mutex_.
+    size_t busy_{};         ///< Workers still draining the current job, guarded by mutex_.
+    bool stopping_{};
+
+    TaskFn fn_{};
+    void* context_{};
+    size_t count_{};
+    std::atomic<size_t> next_{};
+};
+
+} // namespace velk
+
+#endif // VELK_ANIMATOR_WORKER_POOL_H
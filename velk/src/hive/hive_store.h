@@ -1,10 +1,11 @@
 #ifndef VELK_PLUGINS_HIVE_STORE_H
 #define VELK_PLUGINS_HIVE_STORE_H
 
+#include "slot_allocator.h"
+
 #include <velk/ext/core_object.h>
 #include <velk/interface/hive/intf_hive_store.h>
 
-#include <vector>
 
 namespace velk {
 
@@ -35,7 +36,7 @@ private:
         bool operator<(const HiveEntry& o) const { return uid < o.uid; }
     };
 
-    std::vector<HiveEntry> hives_;
+    slot_vector<HiveEntry> hives_;
 };
 
 } // namespace velk
@@ -21,6 +21,12 @@ struct HiveControlBlock
     HivePage* page;
 };
 
+/** @brief Returns a page's memory to the Hive allocator slot. */
+static void free_page_memory(HivePage& page)
+{
+    detail::deallocate(page.allocation, page.allocation_size, page.allocation_align, AllocatorSlot::Hive);
+}
+
 /**
  * @brief Shared destroy logic for hive-managed objects.
  *
@@ -89,8 +95,8 @@ static void hive_destroy_impl(HiveControlBlock* hcb, bool orphan)
                 auto* h = reinterpret_cast<HiveControlBlock*>(ecb);
                 HivePage* p = h->page;
                 if (p->weak_hcb_count.fetch_sub(1, std::memory_order_acq_rel) == 1 && p->live_count == 0) {
-                    aligned_free_impl(p->allocation);
-                    delete p;
+                    free_page_memory(*p);
+                    SlotDeleter<HivePage>{AllocatorSlot::Hive}(p);
                 }
             };
             page->weak_hcb_count.fetch_add(1, std::memory_order_relaxed);
@@ -101,8 +107,8 @@ static void hive_destroy_impl(HiveControlBlock* hcb, bool orphan)
     --page->live_count;
 
     if (orphan && page->live_count == 0 && page->weak_hcb_count.load(std::memory_order_acquire) == 0) {
-        aligned_free_impl(page->allocation);
-        delete page;
+        free_page_memory(*page);
+        SlotDeleter<HivePage>{AllocatorSlot::Hive}(page);
     }
 }
 
@@ -191,6 +197,29 @@ void ObjectHive::set_page_capacity(const HivePageCapacity& capacity)
     capacity_ = check_capacity(capacity);
 }
 
+size_t ObjectHive::get_page_count() const
+{
+    std::shared_lock lock(mutex_);
+    return pages_.size();
+}
+
+bool ObjectHive::get_page(size_t index, HivePageView& out) const
+{
+    std::shared_lock lock(mutex_);
+    if (index >= pages_.size()) {
+        return false;
+    }
+    auto& page = *pages_[index];
+    // live_count also counts zombies, which have no active bit
+    size_t live = 0;
+    size_t num_words = bitmask_words(page.capacity);
+    for (size_t w = 0; w < num_words; ++w) {
+        live += popcount64(page.active_bits[w]);
+    }
+    out = {page.slots, slot_size_, page.capacity, live, page.active_bits};
+    return true;
+}
+
 void* ObjectHive::slot_ptr(HivePage& page, size_t index) const
 {
     return static_cast<char*>(page.slots) + index * slot_size_;
@@ -203,7 +232,7 @@ void* ObjectHive::slot_ptr(const HivePage& page, size_t index) const
 
 void ObjectHive::alloc_page(size_t capacity)
 {
-    auto page = std::make_unique<HivePage>();
+    auto page = make_slot_unique<HivePage>(AllocatorSlot::Hive);
     page->capacity = capacity;
     page->slot_size = slot_size_;
     page->factory = factory_;
@@ -221,8 +250,10 @@ void ObjectHive::alloc_page(size_t capacity)
     size_t slots_bytes = capacity * slot_size_;
     size_t total = slots_offset + slots_bytes;
 
-    auto* mem = static_cast<char*>(aligned_alloc_impl(slot_alignment_, total));
+    auto* mem = static_cast<char*>(detail::allocate(total, slot_alignment_, AllocatorSlot::Hive));
     page->allocation = mem;
+    page->allocation_size = total;
+    page->allocation_align = slot_alignment_;
     page->state = reinterpret_cast<SlotState*>(mem);
     page->active_bits = reinterpret_cast<uint64_t*>(mem + bits_offset);
     page->hcbs = reinterpret_cast<HiveControlBlock*>(mem + hcbs_offset);
@@ -244,7 +275,7 @@ void ObjectHive::alloc_page(size_t capacity)
 
 void ObjectHive::free_page(HivePage& page)
 {
-    aligned_free_impl(page.allocation);
+    free_page_memory(page);
     page.allocation = nullptr;
     page.state = nullptr;
     page.active_bits = nullptr;
@@ -388,7 +419,7 @@ void ObjectHive::clear()
 
     // Collect all active objects under the lock, then unref outside it.
     // unref() may trigger hive_destroy which re-acquires the lock to reclaim slots.
-    std::vector<IObject*> to_unref;
+    slot_vector<IObject*, AllocatorSlot::Hive> to_unref;
 
     {
         std::lock_guard<std::shared_mutex> lock(mutex_);
@@ -2,6 +2,7 @@
 #define VELK_PLUGINS_OBJECT_HIVE_H
 
 #include "page_allocator.h"
+#include "slot_allocator.h"
 
 #include <velk/ext/core_object.h>
 #include <velk/interface/hive/intf_hive.h>
@@ -27,6 +28,8 @@ struct HiveControlBlock;
 struct HivePage
 {
     void* allocation{nullptr};              ///< Single aligned allocation for all arrays + slots.
+    size_t allocation_size{0};              ///< Size of @c allocation in bytes.
+    size_t allocation_align{0};             ///< Alignment of @c allocation.
     SlotState* state{nullptr};              ///< Per-slot state array (points into allocation).
     uint64_t* active_bits{nullptr};         ///< Bitmask: 1 bit per slot, set = Active.
     HiveControlBlock* hcbs{nullptr};        ///< Contiguous HCB array (embedded, points into allocation).
@@ -68,6 +71,8 @@ public:
     void clear() override;
     HivePageCapacity get_page_capacity() const override;
     void set_page_capacity(const HivePageCapacity& capacity) override;
+    size_t get_page_count() const override;
+    bool get_page(size_t index, HivePageView& out) const override;
 
     // IObjectHive overrides
     IObject::Ptr add() override;
@@ -107,7 +112,7 @@ private:
     size_t slot_alignment_{0};
     size_t live_count_{0};
     HivePage* current_page_{nullptr}; ///< Hint: last page with free slots.
-    std::vector<std::unique_ptr<HivePage>> pages_;
+    slot_vector<slot_unique_ptr<HivePage>, AllocatorSlot::Hive> pages_;
     HivePageCapacity capacity_;
 };
 
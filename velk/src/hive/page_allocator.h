@@ -11,33 +11,12 @@
 
 #ifdef _WIN32
 #include <intrin.h>
-#include <malloc.h>
-#else
-#include <cstdlib>
 #endif
 
 namespace velk {
 
 static constexpr size_t PAGE_SENTINEL = ~size_t(0);
 
-inline void* aligned_alloc_impl(size_t alignment, size_t size)
-{
-#ifdef _WIN32
-    return _aligned_malloc(size, alignment);
-#else
-    return std::aligned_alloc(alignment, size);
-#endif
-}
-
-inline void aligned_free_impl(void* ptr)
-{
-#ifdef _WIN32
-    _aligned_free(ptr);
-#else
-    std::free(ptr);
-#endif
-}
-
 inline size_t align_up(size_t size, size_t alignment)
 {
     return (size + alignment - 1) & ~(alignment - 1);
@@ -69,6 +48,16 @@ inline unsigned bitscan_forward64(uint64_t mask)
 #endif
 }
 
+/** @brief Returns the number of set bits in @p mask. */
+inline unsigned popcount64(uint64_t mask)
+{
+#ifdef _WIN32
+    return static_cast<unsigned>(__popcnt64(mask));
+#else
+    return static_cast<unsigned>(__builtin_popcountll(mask));
+#endif
+}
+
 /** @brief Number of uint64_t words needed for a bitmask covering @p capacity slots. */
 inline size_t bitmask_words(size_t capacity)
 {
@@ -46,6 +46,23 @@ void RawHiveImpl::set_page_capacity(const HivePageCapacity& capacity)
     capacity_ = check_capacity(capacity);
 }
 
+size_t RawHiveImpl::get_page_count() const
+{
+    std::shared_lock lock(mutex_);
+    return pages_.size();
+}
+
+bool RawHiveImpl::get_page(size_t index, HivePageView& out) const
+{
+    std::shared_lock lock(mutex_);
+    if (index >= pages_.size()) {
+        return false;
+    }
+    auto& page = *pages_[index];
+    out = {page.slots, slot_size_, page.capacity, page.live_count, page.active_bits};
+    return true;
+}
+
 void* RawHiveImpl::slot_ptr(const RawHivePage& page, size_t index) const
 {
     return static_cast<char*>(page.slots) + index * slot_size_;
@@ -53,7 +70,7 @@ void* RawHiveImpl::slot_ptr(const RawHivePage& page, size_t index) const
 
 void RawHiveImpl::alloc_page(size_t capacity)
 {
-    auto page = std::make_unique<RawHivePage>();
+    auto page = make_slot_unique<RawHivePage>(slot_);
     page->capacity = capacity;
     page->slot_size = slot_size_;
 
@@ -66,8 +83,10 @@ void RawHiveImpl::alloc_page(size_t capacity)
     size_t slots_bytes = capacity * slot_size_;
     size_t total = slots_offset + slots_bytes;
 
-    auto* mem = static_cast<char*>(aligned_alloc_impl(alloc_align, total));
+    auto* mem = static_cast<char*>(detail::allocate(total, alloc_align, slot_));
     page->allocation = mem;
+    page->allocation_size = total;
+    page->allocation_align = alloc_align;
     page->active_bits = reinterpret_cast<uint64_t*>(mem);
     page->slots = mem + slots_offset;
 
@@ -80,6 +99,12 @@ void RawHiveImpl::alloc_page(size_t capacity)
     pages_.push_back(std::move(page));
 }
 
+void RawHiveImpl::free_page(RawHivePage& page)
+{
+    detail::deallocate(page.allocation, page.allocation_size, page.allocation_align, slot_);
+    page.allocation = nullptr;
+}
+
 void* RawHiveImpl::allocate()
 {
     check_iteration_guard(mutex_, "allocate");
@@ -239,7 +264,7 @@ void RawHiveImpl::clear(void* context, DestroyFn destroy)
                 }
             }
         }
-        aligned_free_impl(page.allocation);
+        free_page(page);
     }
     pages_.clear();
     current_page_ = nullptr;
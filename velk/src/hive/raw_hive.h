@@ -2,6 +2,7 @@
 #define VELK_SRC_RAW_HIVE_H
 
 #include "page_allocator.h"
+#include "slot_allocator.h"
 
 #include <velk/ext/core_object.h>
 #include <velk/interface/hive/intf_hive.h>
@@ -23,6 +24,8 @@ namespace velk {
 struct RawHivePage
 {
     void* allocation{nullptr};
+    size_t allocation_size{0};
+    size_t allocation_align{0};
     uint64_t* active_bits{nullptr};
     void* slots{nullptr};
     size_t capacity{0};
@@ -50,6 +53,9 @@ public:
     /** @brief Initializes the hive for the given element UID, size, and alignment. */
     void init(Uid elementUid, size_t elementSize, size_t elementAlign);
 
+    /** @brief Selects the allocator slot used for pages. Must be called before the first allocation. */
+    void set_allocator_slot(AllocatorSlot slot) { slot_ = slot; }
+
     // IHive overrides
     HiveType get_hive_type() const override { return HiveType::RawHive; }
     Uid get_element_uid() const override;
@@ -59,6 +65,8 @@ public:
 
     HivePageCapacity get_page_capacity() const override;
     void set_page_capacity(const HivePageCapacity& capacity) override;
+    size_t get_page_count() const override;
+    bool get_page(size_t index, HivePageView& out) const override;
 
     // IRawHive overrides
     void* allocate() override;
@@ -70,14 +78,16 @@ public:
 private:
     void* slot_ptr(const RawHivePage& page, size_t index) const;
     void alloc_page(size_t capacity);
+    void free_page(RawHivePage& page);
 
     mutable std::shared_mutex mutex_;
     Uid element_uid_;
     size_t slot_size_{0};
     size_t slot_align_{0};
     size_t live_count_{0};
+    AllocatorSlot slot_{AllocatorSlot::Hive};
     RawHivePage* current_page_{nullptr};
-    std::vector<std::unique_ptr<RawHivePage>> pages_;
+    slot_vector<slot_unique_ptr<RawHivePage>, AllocatorSlot::Hive> pages_;
     HivePageCapacity capacity_;
 };
 
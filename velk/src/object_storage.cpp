@@ -22,6 +22,11 @@ ObjectStorage::ObjectStorage(array_view<MemberDesc> members, IInterface* owner)
       owner_(owner)
 {}
 
+ObjectStorage::~ObjectStorage()
+{
+    detail::deallocate(ordinals_, members_.size() * sizeof(uint32_t), alignof(uint32_t), AllocatorSlot::Metadata);
+}
+
 array_view<MemberDesc> ObjectStorage::get_static_metadata() const
 {
     return members_;
@@ -111,7 +116,11 @@ void ObjectStorage::bind(const MemberDesc& m, const IInterface::Ptr& fn) const
 
 IInterface::Ptr ObjectStorage::find_or_create(string_view name, MemberKind kind, Resolve mode) const
 {
-    auto matches = [&](const MemberDesc& m) { return m.kind == kind && m.name == name; };
+    // Compare kind and length first, so the name bytes are only compared for same-length members.
+    // Hashing the query would cost a pass over the name on every call, more than it saves for short names.
+    auto matches = [&](const MemberDesc& m) {
+        return m.kind == kind && m.name.size() == name.size() && m.name == name;
+    };
 
     // Check cache first (skip attachment region)
     for (size_t i = attachment_end_; i < instances_.size(); ++i) {
@@ -132,12 +141,54 @@ IInterface::Ptr ObjectStorage::find_or_create(string_view name, MemberKind kind,
             // Bind (if function)
             bind(m, created);
             // Add to metadata
-            instances_.emplace_back(i, created);
+            cache(i, created);
         }
     }
     return created;
 }
 
+void ObjectStorage::cache(size_t index, const IInterface::Ptr& instance) const
+{
+    if (ordinals_) {
+        ordinals_[index] = static_cast<uint32_t>(instances_.size() - attachment_end_ + 1);
+    }
+    instances_.emplace_back(index, instance);
+}
+
+void ObjectStorage::build_ordinals() const
+{
+    ordinals_ = static_cast<uint32_t*>(
+        detail::allocate(members_.size() * sizeof(uint32_t), alignof(uint32_t), AllocatorSlot::Metadata));
+    std::fill_n(ordinals_, members_.size(), 0u);
+    for (size_t i = attachment_end_; i < instances_.size(); ++i) {
+        ordinals_[instances_[i].first] = static_cast<uint32_t>(i - attachment_end_ + 1);
+    }
+}
+
+IInterface::Ptr ObjectStorage::get_or_create(size_t index, Resolve mode) const
+{
+    // Constant time: the table maps the member index straight to its cached instance
+    if (!ordinals_) {
+        build_ordinals();
+    }
+    if (uint32_t pos = ordinals_[index]) {
+        return instances_[attachment_end_ + pos - 1].second;
+    }
+    if (mode == Resolve::Existing) {
+        return {};
+    }
+    auto& m = members_[index];
+    auto created = create(m);
+    bind(m, created);
+    cache(index, created);
+    return created;
+}
+
+IInterface::Ptr ObjectStorage::get_member(size_t index, Resolve mode) const
+{
+    return index < members_.size() ? get_or_create(index, mode) : nullptr;
+}
+
 IProperty::Ptr ObjectStorage::get_property(string_view name, Resolve mode) const
 {
     auto result = find_or_create(name, MemberKind::Property, mode);
@@ -3,6 +3,7 @@
 
 #include <velk/ext/refcounted_dispatch.h>
 #include <velk/interface/intf_object_storage.h>
+#include <velk/small_vector.h>
 
 #include <memory>
 #include <vector>
@@ -17,10 +18,16 @@ namespace velk {
  * PropertyImpl/FunctionImpl instances on first access via get_property()/get_event()/
  * get_function(). Created instances are cached for subsequent lookups.
  *
- * The instances_ vector is partitioned: [0, attachment_end_) holds attachments,
+ * The instances_ small_vector is partitioned: [0, attachment_end_) holds attachments,
  * [attachment_end_, size()) holds metadata instances. Attachment entries use SIZE_MAX
  * as the index sentinel.
  *
+ * Lookups by member index (get_member()) go through ordinals_, a table with one entry per
+ * member that is built on the first such lookup. It holds the position of the member's
+ * instance in the metadata region plus one, or 0 if the instance has not been created.
+ * Positions are relative to attachment_end_ and stay valid because metadata entries are only
+ * appended and never removed.
+ *
  * Does not inherit RefCountedDispatch; lifetime is managed by the owning Object
  * (allocated by VelkInstance at construction, deleted in Object's destructor).
  */
@@ -33,6 +40,9 @@ public:
      * @param owner The owning object, used to bind function trampolines and resolve property state.
      */
     explicit ObjectStorage(array_view<MemberDesc> members, IInterface* owner = nullptr);
+    ~ObjectStorage() override;
+    ObjectStorage(const ObjectStorage&) = delete;
+    ObjectStorage& operator=(const ObjectStorage&) = delete;
 
 public: // IObject (inherited via IObjectStorage; not used as an IObject)
     Uid get_class_uid() const override { return {}; }
@@ -48,6 +58,7 @@ public: // IMetadata
     IProperty::Ptr get_property(string_view name, Resolve mode = Resolve::Create) const override;
     IEvent::Ptr get_event(string_view name, Resolve mode = Resolve::Create) const override;
     IFunction::Ptr get_function(string_view name, Resolve mode = Resolve::Create) const override;
+    IInterface::Ptr get_member(size_t index, Resolve mode = Resolve::Create) const override;
     void notify(MemberKind kind, Uid interfaceUid, Notification notification) const override;
 
 public: // IObjectStorage (attachment operations)
@@ -63,11 +74,18 @@ private:
 
     /// Lazily populated cache: [0, attachment_end_) = attachments (idx == SIZE_MAX),
     ///                         [attachment_end_, size()) = metadata instances.
-    mutable std::vector<std::pair<size_t, IInterface::Ptr>> instances_;
+    mutable small_vector<std::pair<size_t, IInterface::Ptr>, 1, AllocatorSlot::Metadata> instances_;
     mutable uint32_t attachment_end_{0}; ///< Boundary between attachments and metadata entries.
+    mutable uint32_t* ordinals_{};       ///< Per-member positions in the metadata region, see above.
 
     /** @brief Finds a static member by name and kind, creating its runtime instance if needed. */
     IInterface::Ptr find_or_create(string_view name, MemberKind kind, Resolve mode) const;
+    /** @brief Returns the cached runtime instance of members_[index], creating it if needed. */
+    IInterface::Ptr get_or_create(size_t index, Resolve mode) const;
+    /** @brief Appends the runtime instance of members_[index] to the cache. */
+    void cache(size_t index, const IInterface::Ptr& instance) const;
+    /** @brief Allocates ordinals_ and fills it from the instances created so far. */
+    void build_ordinals() const;
     /** @brief Creates a runtime instance (PropertyImpl or FunctionImpl) from a member descriptor. */
     IInterface::Ptr create(MemberDesc desc) const;
     /** @brief Binds a function instance to the owner's virtual trampoline. */
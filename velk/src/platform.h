@@ -5,6 +5,7 @@
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
 #endif
+#include <malloc.h>
 #include <windows.h>
 #else
 #include <dlfcn.h>
@@ -13,8 +14,31 @@
 
 #include <velk/string.h>
 
+#include <cstdlib>
+
 namespace velk {
 
+/** @brief Allocates @p size bytes aligned to @p alignment from the system heap. */
+inline void* aligned_alloc_impl(size_t alignment, size_t size)
+{
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    // std::aligned_alloc requires size to be a multiple of alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+/** @brief Frees memory returned by aligned_alloc_impl(). */
+inline void aligned_free_impl(void* ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
 /** @brief Returns the directory containing the velk shared library (with trailing separator). */
 inline string get_module_directory()
 {
@@ -2,12 +2,16 @@
 
 #include <velk/ext/plugin.h>
 #include <velk/interface/intf_log.h>
+#include <velk/small_vector.h>
 
 #include <algorithm>
 #include <chrono>
 
 namespace velk {
 
+/** @brief Snapshot of the update plugins, inline for the usual handful of plugins. */
+using UpdatePluginList = small_vector<IPlugin*, 8>;
+
 static int64_t now_us()
 {
     using namespace std::chrono;
@@ -275,8 +279,9 @@ UpdateInfo PluginRegistry::pre_update_plugins(Duration time) const
     info.dt = {t.dt.us ? current_us - t.dt.us : 0};
     t.dt.us = current_us;
 
-    // Snapshot: plugins may load/unload other plugins during callbacks.
-    auto plugins = update_plugins_;
+    // Snapshot: plugins may load/unload other plugins during callbacks. Held inline, so
+    // a frame does not allocate.
+    UpdatePluginList plugins(update_plugins_.data(), update_plugins_.data() + update_plugins_.size());
     for (auto* plugin : plugins) {
         plugin->pre_update({info});
     }
@@ -286,7 +291,7 @@ UpdateInfo PluginRegistry::pre_update_plugins(Duration time) const
 
 void PluginRegistry::post_update_plugins(const IPlugin::PostUpdateInfo& info) const
 {
-    auto plugins = update_plugins_;
+    UpdatePluginList plugins(update_plugins_.data(), update_plugins_.data() + update_plugins_.size());
     for (auto* plugin : plugins) {
         plugin->post_update(info);
     }
@@ -2,6 +2,7 @@
 #define VELK_PLUGIN_REGISTRY_H
 
 #include "library_handle.h"
+#include "slot_allocator.h"
 #include "type_registry.h"
 
 #include <velk/common.h>
@@ -10,7 +11,6 @@
 #include <velk/interface/intf_velk.h>
 #include <velk/string.h>
 
-#include <vector>
 
 namespace velk {
 
@@ -54,8 +54,8 @@ private:
     /** @brief Checks that all dependencies declared in info are loaded. Logs and returns Fail if not. */
     ReturnValue check_dependencies(const PluginInfo& info);
 
-    std::vector<PluginEntry> plugins_;        ///< Sorted registry of loaded plugins.
-    std::vector<IPlugin*> update_plugins_;    ///< Plugins that opted into update notifications.
+    slot_vector<PluginEntry> plugins_;        ///< Sorted registry of loaded plugins.
+    slot_vector<IPlugin*> update_plugins_;    ///< Plugins that opted into update notifications.
     mutable UpdateInfo update_timestamps_;    ///< Absolute timestamps for init, first update, last update.
     mutable bool last_update_was_explicit_{}; ///< Whether previous update used explicit time.
     ILog& log_;
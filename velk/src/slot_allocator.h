@@ -0,0 +1,104 @@
+#ifndef VELK_SLOT_ALLOCATOR_H
+#define VELK_SLOT_ALLOCATOR_H
+
+#include <velk/allocator.h>
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace velk {
+
+/**
+ * @brief Standard-library allocator adapter that routes through a velk AllocatorSlot.
+ *
+ * Used for internal std containers so that their storage honors the allocator
+ * installed via IVelk::set_allocator().
+ *
+ * @tparam T    The element type.
+ * @tparam Slot The allocator slot to allocate from.
+ */
+template <class T, AllocatorSlot Slot = AllocatorSlot::Default>
+struct SlotAllocator
+{
+    using value_type = T;
+
+    template <class U>
+    struct rebind
+    {
+        using other = SlotAllocator<U, Slot>;
+    };
+
+    SlotAllocator() noexcept = default;
+    template <class U>
+    SlotAllocator(const SlotAllocator<U, Slot>&) noexcept
+    {}
+
+    T* allocate(size_t n)
+    {
+        auto* p = detail::allocate(n * sizeof(T), alignof(T), Slot);
+        assert(p && "SlotAllocator allocation failed");
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept { detail::deallocate(p, n * sizeof(T), alignof(T), Slot); }
+
+    template <class U>
+    bool operator==(const SlotAllocator<U, Slot>&) const noexcept
+    {
+        return true;
+    }
+    template <class U>
+    bool operator!=(const SlotAllocator<U, Slot>&) const noexcept
+    {
+        return false;
+    }
+};
+
+/** @brief std::vector whose storage is allocated from an AllocatorSlot. */
+template <class T, AllocatorSlot Slot = AllocatorSlot::Default>
+using slot_vector = std::vector<T, SlotAllocator<T, Slot>>;
+
+/** @brief std::unordered_map whose nodes and buckets are allocated from an AllocatorSlot. */
+template <class K, class V, AllocatorSlot Slot = AllocatorSlot::Default, class Hash = std::hash<K>>
+using slot_unordered_map =
+    std::unordered_map<K, V, Hash, std::equal_to<K>, SlotAllocator<std::pair<const K, V>, Slot>>;
+
+/**
+ * @brief Deleter for objects created with make_slot_unique().
+ *
+ * Stores the slot, so a single owner type can hold objects from slots chosen at runtime.
+ */
+template <class T>
+struct SlotDeleter
+{
+    AllocatorSlot slot{AllocatorSlot::Default};
+
+    void operator()(T* p) const noexcept
+    {
+        p->~T();
+        detail::deallocate(p, sizeof(T), alignof(T), slot);
+    }
+};
+
+/** @brief unique_ptr to an object allocated from an AllocatorSlot. */
+template <class T>
+using slot_unique_ptr = std::unique_ptr<T, SlotDeleter<T>>;
+
+/** @brief Constructs a T in memory allocated from @p slot. */
+template <class T, class... Args>
+slot_unique_ptr<T> make_slot_unique(AllocatorSlot slot, Args&&... args)
+{
+    auto* p = detail::allocate(sizeof(T), alignof(T), slot);
+    assert(p && "make_slot_unique allocation failed");
+    return slot_unique_ptr<T>(new (p) T(std::forward<Args>(args)...), SlotDeleter<T>{slot});
+}
+
+} // namespace velk
+
+#endif // VELK_SLOT_ALLOCATOR_H
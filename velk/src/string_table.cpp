@@ -0,0 +1,138 @@
+#include <velk/interned_string.h>
+#include <velk/velk_export.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace velk {
+
+// Global string table
+//
+// The table is split into shards selected by the top bits of the hash, each
+// with its own mutex, so concurrent interning of unrelated strings rarely
+// contends. A shard is an open-addressing hash set of entry pointers with
+// linear probing, kept at most half full. Entries are bump-allocated from
+// chunks and are never freed, so handles stay valid for the lifetime of the
+// process. The table is constant-initialized, which makes intern() usable
+// during static init.
+//
+// The table takes its memory directly from malloc rather than from an
+// allocator slot: entries are never freed, so they would keep the slot's
+// outstanding count above zero forever and make install_allocator() fail
+// for that slot (and for Default, which backs the other slots).
+
+namespace {
+
+constexpr size_t shard_count = 16;
+constexpr size_t shard_bits = 4;
+constexpr size_t initial_slots = 64;
+constexpr size_t chunk_size = 4096;
+
+struct string_shard
+{
+    std::mutex mutex;
+    const detail::interned_entry** slots{};
+    size_t capacity{}; ///< Number of slots (power of two), 0 before first use.
+    size_t count{};
+    char* chunk{};        ///< Current chunk for entry storage.
+    size_t chunk_left{}; ///< Bytes left in @c chunk.
+};
+
+string_shard g_shards[shard_count];
+
+size_t entry_bytes(size_t size)
+{
+    size_t bytes = offsetof(detail::interned_entry, data) + size + 1;
+    return (bytes + alignof(detail::interned_entry) - 1) & ~(alignof(detail::interned_entry) - 1);
+}
+
+detail::interned_entry* new_entry(string_shard& shard, string_view str, uint64_t hash)
+{
+    size_t bytes = entry_bytes(str.size());
+    void* mem;
+    if (bytes > chunk_size / 4) {
+        // Long strings get their own allocation instead of wasting a chunk tail
+        mem = std::malloc(bytes);
+    } else {
+        if (bytes > shard.chunk_left) {
+            auto* chunk = static_cast<char*>(std::malloc(chunk_size));
+            if (!chunk) {
+                return nullptr;
+            }
+            shard.chunk = chunk;
+            shard.chunk_left = chunk_size;
+        }
+        mem = shard.chunk;
+        shard.chunk += bytes;
+        shard.chunk_left -= bytes;
+    }
+    if (!mem) {
+        return nullptr;
+    }
+    auto* e = static_cast<detail::interned_entry*>(mem);
+    e->hash = hash;
+    e->size = str.size();
+    std::memcpy(e->data, str.data(), str.size());
+    e->data[str.size()] = '\0';
+    return e;
+}
+
+/** @brief Returns the slot for @p str in @p slots: either its entry or the empty slot to insert into. */
+const detail::interned_entry** probe(const detail::interned_entry** slots, size_t capacity, string_view str,
+                                     uint64_t hash)
+{
+    size_t mask = capacity - 1;
+    for (size_t i = static_cast<size_t>(hash) & mask;; i = (i + 1) & mask) {
+        auto* e = slots[i];
+        if (!e || (e->hash == hash && e->size == str.size() && std::memcmp(e->data, str.data(), str.size()) == 0)) {
+            return slots + i;
+        }
+    }
+}
+
+bool grow(string_shard& shard)
+{
+    size_t new_capacity = shard.capacity ? shard.capacity * 2 : initial_slots;
+    size_t bytes = new_capacity * sizeof(void*);
+    auto** slots = static_cast<const detail::interned_entry**>(std::malloc(bytes));
+    if (!slots) {
+        return false;
+    }
+    std::memset(static_cast<void*>(slots), 0, bytes);
+    for (size_t i = 0; i < shard.capacity; ++i) {
+        if (auto* e = shard.slots[i]) {
+            *probe(slots, new_capacity, {e->data, e->size}, e->hash) = e;
+        }
+    }
+    std::free(static_cast<void*>(shard.slots));
+    shard.slots = slots;
+    shard.capacity = new_capacity;
+    return true;
+}
+
+} // anonymous namespace
+
+VELK_EXPORT const detail::interned_entry* detail::intern(string_view str)
+{
+    if (str.empty()) {
+        return nullptr;
+    }
+    uint64_t hash = hash_string(str);
+    auto& shard = g_shards[hash >> (64 - shard_bits)];
+    std::lock_guard lock(shard.mutex);
+    if ((shard.count + 1) * 2 > shard.capacity && !grow(shard)) {
+        return nullptr;
+    }
+    auto** slot = probe(shard.slots, shard.capacity, str, hash);
+    if (!*slot) {
+        *slot = new_entry(shard, str, hash);
+        if (*slot) {
+            ++shard.count;
+        }
+    }
+    return *slot;
+}
+
+} // namespace velk
@@ -0,0 +1,180 @@
+#include <velk/type_index.h>
+#include <velk/velk_export.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace velk {
+
+// Global type index table
+//
+// UIDs are stored by index in fixed-size pages that never move, so a published
+// index always refers to the same Uid. Lookups go through an open-addressing
+// hash set of (index + 1) values with linear probing, kept at most half full.
+// Readers are lock-free: a writer fills in the Uid before publishing its slot
+// with a release store, and a grown slot table replaces the old one with a
+// release store of the table pointer. Old slot tables are kept alive (they
+// stay valid for readers that loaded them) and, like the pages, are never
+// freed. The table is constant-initialized, so type_index() is usable during
+// static init. Since nothing is ever freed, memory comes directly from malloc
+// and is not counted against an allocator slot, which would otherwise report
+// outstanding allocations forever and refuse install_allocator().
+
+namespace {
+
+constexpr size_t page_bits = 8;
+constexpr size_t page_size = size_t(1) << page_bits;
+constexpr size_t max_pages = 4096; ///< Up to 1M indices.
+constexpr size_t initial_slots = 256;
+
+struct slot_table
+{
+    size_t mask;
+    std::atomic<uint32_t> slots[1]; ///< (index + 1) per slot, 0 when empty (allocated to mask + 1).
+};
+
+struct type_index_table
+{
+    std::mutex mutex;
+    std::atomic<Uid*> pages[max_pages]{};
+    std::atomic<slot_table*> table{};
+    uint32_t count{}; ///< Guarded by @c mutex.
+};
+
+type_index_table g_table;
+
+size_t hash_uid(const Uid& uid)
+{
+    // UIDs are FNV hashes or random UUIDs, so a cheap mix of both halves distributes well
+    return static_cast<size_t>(uid.lo ^ (uid.hi * 0x9e3779b97f4a7c15ull));
+}
+
+const Uid& uid_at(uint32_t index)
+{
+    return g_table.pages[index >> page_bits].load(std::memory_order_acquire)[index & (page_size - 1)];
+}
+
+TypeIndex find_in(const slot_table* t, const Uid& uid)
+{
+    for (size_t i = hash_uid(uid) & t->mask;; i = (i + 1) & t->mask) {
+        uint32_t v = t->slots[i].load(std::memory_order_acquire);
+        if (!v) {
+            return invalid_type_index;
+        }
+        if (uid_at(v - 1) == uid) {
+            return v - 1;
+        }
+    }
+}
+
+void insert_into(slot_table* t, const Uid& uid, uint32_t index)
+{
+    size_t i = hash_uid(uid) & t->mask;
+    while (t->slots[i].load(std::memory_order_relaxed)) {
+        i = (i + 1) & t->mask;
+    }
+    t->slots[i].store(index + 1, std::memory_order_release);
+}
+
+slot_table* new_table(size_t capacity)
+{
+    size_t bytes = sizeof(slot_table) + (capacity - 1) * sizeof(std::atomic<uint32_t>);
+    void* mem = std::malloc(bytes);
+    if (!mem) {
+        return nullptr;
+    }
+    auto* t = static_cast<slot_table*>(mem);
+    t->mask = capacity - 1;
+    for (size_t i = 0; i < capacity; ++i) {
+        new (&t->slots[i]) std::atomic<uint32_t>(0);
+    }
+    return t;
+}
+
+/** @brief Ensures the slot table has room for one more entry. Called with the mutex held. */
+slot_table* reserve_slot()
+{
+    auto* t = g_table.table.load(std::memory_order_relaxed);
+    size_t capacity = t ? t->mask + 1 : 0;
+    if ((size_t(g_table.count) + 1) * 2 <= capacity) {
+        return t;
+    }
+    auto* grown = new_table(capacity ? capacity * 2 : initial_slots);
+    if (!grown) {
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < g_table.count; ++i) {
+        insert_into(grown, uid_at(i), i);
+    }
+    g_table.table.store(grown, std::memory_order_release);
+    return grown;
+}
+
+/** @brief Assigns the next index to @p uid. Called with the mutex held. */
+TypeIndex append(const Uid& uid)
+{
+    uint32_t index = g_table.count;
+    size_t page_idx = index >> page_bits;
+    if (page_idx >= max_pages) {
+        return invalid_type_index;
+    }
+    auto* t = reserve_slot();
+    if (!t) {
+        return invalid_type_index;
+    }
+    auto* page = g_table.pages[page_idx].load(std::memory_order_relaxed);
+    if (!page) {
+        void* mem = std::malloc(page_size * sizeof(Uid));
+        if (!mem) {
+            return invalid_type_index;
+        }
+        std::memset(mem, 0, page_size * sizeof(Uid));
+        page = static_cast<Uid*>(mem);
+        g_table.pages[page_idx].store(page, std::memory_order_release);
+    }
+    page[index & (page_size - 1)] = uid;
+    insert_into(t, uid, index);
+    ++g_table.count;
+    return index;
+}
+
+} // anonymous namespace
+
+VELK_EXPORT TypeIndex detail::find_type_index(Uid uid)
+{
+    auto* t = g_table.table.load(std::memory_order_acquire);
+    return t ? find_in(t, uid) : invalid_type_index;
+}
+
+VELK_EXPORT TypeIndex detail::type_index(Uid uid)
+{
+    if (auto index = find_type_index(uid); index != invalid_type_index) {
+        return index;
+    }
+    std::lock_guard lock(g_table.mutex);
+    if (g_table.count == 0 && append(Uid{}) == invalid_type_index) {
+        // Index 0 is reserved for Uid{} so that the IInterface UID always maps to 0
+        return invalid_type_index;
+    }
+    if (auto index = find_in(g_table.table.load(std::memory_order_relaxed), uid); index != invalid_type_index) {
+        return index;
+    }
+    return append(uid);
+}
+
+VELK_EXPORT Uid detail::type_index_uid(TypeIndex index)
+{
+    size_t page_idx = index >> page_bits;
+    auto* page = page_idx < max_pages ? g_table.pages[page_idx].load(std::memory_order_acquire) : nullptr;
+    if (!page) {
+        return {};
+    }
+    // Unassigned entries in an allocated page are zero, which maps back to index 0
+    const Uid& uid = page[index & (page_size - 1)];
+    return find_type_index(uid) == index ? uid : Uid{};
+}
+
+} // namespace velk
@@ -12,9 +12,9 @@
 
 #include <velk/ext/any.h>
 #include <velk/interface/intf_log.h>
+#include <velk/interned_string.h>
 #include <velk/string.h>
-
-#include <algorithm>
+#include <velk/type_index.h>
 
 namespace velk {
 
@@ -30,6 +30,7 @@ TypeRegistry::TypeRegistry(ILog& log) : log_(log)
     ITypeRegistry::register_type<RawHiveImpl>();
     ITypeRegistry::register_type<HierarchyImpl>();
 
+    ITypeRegistry::register_type<ext::AnyValue<bool>>();
     ITypeRegistry::register_type<ext::AnyValue<float>>();
     ITypeRegistry::register_type<ext::AnyValue<double>>();
     ITypeRegistry::register_type<ext::AnyValue<uint8_t>>();
@@ -41,6 +42,7 @@ TypeRegistry::TypeRegistry(ILog& log) : log_(log)
     ITypeRegistry::register_type<ext::AnyValue<int32_t>>();
     ITypeRegistry::register_type<ext::AnyValue<int64_t>>();
     ITypeRegistry::register_type<ext::AnyValue<string>>();
+    ITypeRegistry::register_type<ext::AnyValue<interned_string>>();
     ITypeRegistry::register_type<ext::AnyValue<Duration>>();
 
     ITypeRegistry::register_type<ext::ArrayAnyValue<float>>();
@@ -54,18 +56,41 @@ TypeRegistry::TypeRegistry(ILog& log) : log_(log)
     ITypeRegistry::register_type<ext::ArrayAnyValue<int32_t>>();
     ITypeRegistry::register_type<ext::ArrayAnyValue<int64_t>>();
     ITypeRegistry::register_type<ext::ArrayAnyValue<string>>();
+    ITypeRegistry::register_type<ext::ArrayAnyValue<interned_string>>();
 }
 
-const IObjectFactory* TypeRegistry::find(Uid uid) const
+VELK_EXPORT const IObjectFactory* detail::find_builtin_any_factory(Uid type)
 {
-    Entry key{uid, nullptr};
-    auto it = std::lower_bound(types_.begin(), types_.end(), key);
-    if (it != types_.end() && it->uid == uid) {
-        return it->factory;
+    // Trivially copyable built-in value types, the ones that can be copied into an InlineAny
+    static const IObjectFactory* const factories[] = {
+        &ext::AnyValue<bool>::get_factory(),
+        &ext::AnyValue<float>::get_factory(),
+        &ext::AnyValue<double>::get_factory(),
+        &ext::AnyValue<uint8_t>::get_factory(),
+        &ext::AnyValue<uint16_t>::get_factory(),
+        &ext::AnyValue<uint32_t>::get_factory(),
+        &ext::AnyValue<uint64_t>::get_factory(),
+        &ext::AnyValue<int8_t>::get_factory(),
+        &ext::AnyValue<int16_t>::get_factory(),
+        &ext::AnyValue<int32_t>::get_factory(),
+        &ext::AnyValue<int64_t>::get_factory(),
+        &ext::AnyValue<interned_string>::get_factory(),
+        &ext::AnyValue<Duration>::get_factory(),
+    };
+    for (auto* factory : factories) {
+        if (factory->get_class_info().uid == type) {
+            return factory;
+        }
     }
     return nullptr;
 }
 
+const IObjectFactory* TypeRegistry::find(Uid uid) const
+{
+    auto* entry = at(types_, detail::find_type_index(uid));
+    return entry ? entry->factory : nullptr;
+}
+
 ReturnValue TypeRegistry::register_type(const IObjectFactory& factory)
 {
     auto& info = factory.get_class_info();
@@ -76,23 +101,22 @@ ReturnValue TypeRegistry::register_type(const IObjectFactory& factory)
                      "Register %.*s",
                      static_cast<int>(info.name.size()),
                      info.name.data());
-    Entry entry{info.uid, &factory, current_owner_};
-    auto it = std::lower_bound(types_.begin(), types_.end(), entry);
-    if (it != types_.end() && it->uid == info.uid) {
-        it->factory = &factory;
-        it->owner = current_owner_;
-    } else {
-        types_.insert(it, entry);
+    auto index = factory.get_type_index();
+    if (index == invalid_type_index) {
+        return ReturnValue::Fail;
+    }
+    if (index >= types_.size()) {
+        types_.resize(index + 1);
     }
+    types_[index] = {&factory, current_owner_};
     return ReturnValue::Success;
 }
 
 ReturnValue TypeRegistry::unregister_type(const IObjectFactory& factory)
 {
-    Entry key{factory.get_class_info().uid, nullptr};
-    auto it = std::lower_bound(types_.begin(), types_.end(), key);
-    if (it != types_.end() && it->uid == key.uid) {
-        types_.erase(it);
+    auto index = factory.get_type_index();
+    if (index < types_.size()) {
+        types_[index] = {};
     }
     return ReturnValue::Success;
 }
@@ -131,33 +155,48 @@ void TypeRegistry::set_owner(Uid uid)
 
 void TypeRegistry::sweep_owner(Uid uid)
 {
-    types_.erase(std::remove_if(types_.begin(), types_.end(), [&](const Entry& e) { return e.owner == uid; }),
-                 types_.end());
-    interpolators_.erase(std::remove_if(interpolators_.begin(),
-                                        interpolators_.end(),
-                                        [&](const InterpolatorEntry& e) { return e.owner == uid; }),
-                         interpolators_.end());
+    for (auto& e : types_) {
+        if (e.factory && e.owner == uid) {
+            e = {};
+        }
+    }
+    for (auto& e : interpolators_) {
+        if (e.fn && e.fnOwner == uid) {
+            e.fn = {};
+            e.fnOwner = {};
+        }
+        if (e.bulk && e.bulkOwner == uid) {
+            e.bulk = {};
+            e.bulkOwner = {};
+        }
+    }
 }
 
 ReturnValue TypeRegistry::register_interpolator(Uid typeUid, InterpolatorFn fn)
 {
-    InterpolatorEntry entry{typeUid, fn, current_owner_};
-    auto it = std::lower_bound(interpolators_.begin(), interpolators_.end(), entry);
-    if (it != interpolators_.end() && it->typeUid == typeUid) {
-        it->fn = fn;
-        it->owner = current_owner_;
-    } else {
-        interpolators_.insert(it, entry);
+    auto index = detail::type_index(typeUid);
+    if (index == invalid_type_index) {
+        return ReturnValue::Fail;
+    }
+    if (index >= interpolators_.size()) {
+        interpolators_.resize(index + 1);
+    }
+    auto& entry = interpolators_[index];
+    entry.fn = fn;
+    entry.fnOwner = current_owner_;
+    // A bulk interpolator from someone else would bypass the replaced function on batched paths
+    if (entry.bulkOwner != current_owner_) {
+        entry.bulk = {};
+        entry.bulkOwner = {};
     }
     return ReturnValue::Success;
 }
 
 ReturnValue TypeRegistry::unregister_interpolator(Uid typeUid)
 {
-    InterpolatorEntry key{typeUid, nullptr, {}};
-    auto it = std::lower_bound(interpolators_.begin(), interpolators_.end(), key);
-    if (it != interpolators_.end() && it->typeUid == typeUid) {
-        interpolators_.erase(it);
+    auto index = detail::find_type_index(typeUid);
+    if (index < interpolators_.size() && (interpolators_[index].fn || interpolators_[index].bulk)) {
+        interpolators_[index] = {};
         return ReturnValue::Success;
     }
     return ReturnValue::NothingToDo;
@@ -165,12 +204,29 @@ ReturnValue TypeRegistry::unregister_interpolator(Uid typeUid)
 
 InterpolatorFn TypeRegistry::find_interpolator(Uid typeUid) const
 {
-    InterpolatorEntry key{typeUid, nullptr, {}};
-    auto it = std::lower_bound(interpolators_.begin(), interpolators_.end(), key);
-    if (it != interpolators_.end() && it->typeUid == typeUid) {
-        return it->fn;
+    auto* entry = at(interpolators_, detail::find_type_index(typeUid));
+    return entry ? entry->fn : nullptr;
+}
+
+ReturnValue TypeRegistry::register_bulk_interpolator(Uid typeUid, BulkInterpolatorFn fn)
+{
+    auto index = detail::type_index(typeUid);
+    if (index == invalid_type_index) {
+        return ReturnValue::Fail;
     }
-    return nullptr;
+    if (index >= interpolators_.size()) {
+        interpolators_.resize(index + 1);
+    }
+    auto& entry = interpolators_[index];
+    entry.bulk = fn;
+    entry.bulkOwner = current_owner_;
+    return ReturnValue::Success;
+}
+
+BulkInterpolatorFn TypeRegistry::find_bulk_interpolator(Uid typeUid) const
+{
+    auto* entry = at(interpolators_, detail::find_type_index(typeUid));
+    return entry ? entry->bulk : nullptr;
 }
 
 } // namespace velk
@@ -1,18 +1,21 @@
 #ifndef VELK_TYPE_REGISTRY_H
 #define VELK_TYPE_REGISTRY_H
 
+#include "slot_allocator.h"
+
 #include <velk/ext/interface_dispatch.h>
 #include <velk/interface/intf_log.h>
 #include <velk/interface/intf_type_registry.h>
 
-#include <vector>
 
 namespace velk {
 
 /**
  * @brief Concrete implementation of ITypeRegistry.
  *
- * Maintains a sorted vector of type factories keyed by class UID.
+ * Factories and interpolators are stored in dense vectors indexed by the TypeIndex
+ * of their UID (see type_index.h), so lookups are a lock-free hash probe in the
+ * global index table followed by direct array indexing.
  * Owned as a stack member by VelkInstance.
  */
 class TypeRegistry final : public ext::InterfaceDispatch<ITypeRegistry>
@@ -28,6 +31,8 @@ public:
     ReturnValue register_interpolator(Uid typeUid, InterpolatorFn fn) override;
     ReturnValue unregister_interpolator(Uid typeUid) override;
     InterpolatorFn find_interpolator(Uid typeUid) const override;
+    ReturnValue register_bulk_interpolator(Uid typeUid, BulkInterpolatorFn fn) override;
+    BulkInterpolatorFn find_bulk_interpolator(Uid typeUid) const override;
 
     /** @brief Creates an instance of a registered type by its UID. */
     IInterface::Ptr create(Uid uid, uint32_t flags = ObjectFlags::None) const;
@@ -37,29 +42,34 @@ public:
     void sweep_owner(Uid uid);
 
 private:
-    /** @brief Registry entry mapping a class UID to its factory. */
+    /** @brief Registry entry for a class factory, stored at the TypeIndex of the class UID. */
     struct Entry
     {
-        Uid uid;                       ///< Class UID.
-        const IObjectFactory* factory; ///< Factory that creates instances of this class.
-        Uid owner;                     ///< Plugin that registered this type (Uid{} = builtin).
-        bool operator<(const Entry& o) const { return uid < o.uid; }
+        const IObjectFactory* factory{}; ///< Factory that creates instances of this class, or nullptr.
+        Uid owner;                       ///< Plugin that registered this type (Uid{} = builtin).
     };
 
     /** @brief Finds the factory for the given class UID, or nullptr if not registered. */
     const IObjectFactory* find(Uid uid) const;
 
-    /** @brief Registry entry mapping a type UID to its interpolator function. */
+    /** @brief Registry entry for an interpolator, stored at the TypeIndex of the value type UID. */
     struct InterpolatorEntry
     {
-        Uid typeUid;
-        InterpolatorFn fn;
-        Uid owner;
-        bool operator<(const InterpolatorEntry& o) const { return typeUid < o.typeUid; }
+        InterpolatorFn fn{};       ///< Single-value interpolator, or nullptr.
+        Uid fnOwner;               ///< Plugin that registered @c fn (Uid{} = builtin).
+        BulkInterpolatorFn bulk{}; ///< Bulk interpolator, or nullptr.
+        Uid bulkOwner;             ///< Plugin that registered @c bulk (Uid{} = builtin).
     };
 
-    std::vector<Entry> types_;                     ///< Sorted registry of class factories.
-    std::vector<InterpolatorEntry> interpolators_; ///< Sorted registry of interpolator functions.
+    /** @brief Returns the entry at @p index in @p entries, or nullptr if out of range. */
+    template <class T>
+    static const T* at(const slot_vector<T>& entries, TypeIndex index)
+    {
+        return index < entries.size() ? &entries[index] : nullptr;
+    }
+
+    slot_vector<Entry> types_;                     ///< Class factories, indexed by TypeIndex.
+    slot_vector<InterpolatorEntry> interpolators_; ///< Interpolator functions, indexed by TypeIndex.
     Uid current_owner_;                            ///< Owner context for type registration.
     ILog& log_;
 };
@@ -1,9 +1,19 @@
 #include "velk_instance.h"
 
+#include "platform.h" // IWYU pragma: keep (platform-specific defines)
+
+#include <velk/allocator.h>
 #include <velk/velk_export.h>
 
+#include <atomic>
 #include <cstdarg>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
 
 namespace velk {
 
@@ -24,11 +34,311 @@ VELK_EXPORT void detail::velk_log(ILog& log, LogLevel level, const char* file, i
     log.dispatch(level, file, line, buf);
 }
 
+// Allocator slots
+//
+// Storage owned by the library goes through detail::allocate()/deallocate() with
+// an AllocatorSlot (object instances and the malloc-backed lookup tables below
+// are the exceptions, see docs/advanced.md). A slot without an installed IAllocator falls back to the
+// Default slot's allocator, and the Default slot falls back to the system heap.
+// The tables are constant-initialized, so they are usable during static init and
+// static destruction.
+//
+// Counters are split into cache-line sized stripes picked by thread, so threads
+// allocating at the same time do not write to a shared cache line. Reads sum the
+// stripes. The counters double as the guard of install_allocator():
+//
+//   - allocate() counts the allocation before it reads the allocator, then checks
+//     g_installing. If an install is in progress it takes the count back and waits.
+//   - deallocate() counts the deallocation after the memory has been freed.
+//   - install_allocator() sets g_installing and then sums the counters. Any
+//     allocation that could still pick the old allocator is already counted, and
+//     any free through it that has not completed is not, so the slot shows
+//     outstanding memory and the install fails rather than racing.
+
+namespace {
+
+constexpr size_t stats_stripe_count = 64;
+
+struct slot_counters
+{
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> bytes_allocated{0};
+    std::atomic<uint64_t> bytes_freed{0};
+};
+
+struct alignas(64) stats_stripe
+{
+    slot_counters slots[allocator_slot_count];
+};
+
+std::atomic<IAllocator*> g_allocators[allocator_slot_count]{};
+stats_stripe g_stats[stats_stripe_count];
+std::atomic<bool> g_installing{false};
+
+slot_counters& local_counters(AllocatorSlot slot)
+{
+    return g_stats[detail::current_thread_tag() % stats_stripe_count].slots[static_cast<size_t>(slot)];
+}
+
+AllocatorStats sum_counters(AllocatorSlot slot)
+{
+    AllocatorStats s{};
+    for (auto& stripe : g_stats) {
+        auto& c = stripe.slots[static_cast<size_t>(slot)];
+        s.allocations += c.allocations.load(std::memory_order_acquire);
+        s.deallocations += c.deallocations.load(std::memory_order_acquire);
+        s.bytes_allocated += c.bytes_allocated.load(std::memory_order_relaxed);
+        s.bytes_freed += c.bytes_freed.load(std::memory_order_relaxed);
+    }
+    return s;
+}
+
+bool has_outstanding(AllocatorSlot slot)
+{
+    auto s = sum_counters(slot);
+    return s.allocations != s.deallocations;
+}
+
+IAllocator* resolve_allocator(AllocatorSlot slot)
+{
+    if (auto* a = g_allocators[static_cast<size_t>(slot)].load(std::memory_order_acquire)) {
+        return a;
+    }
+    return g_allocators[0].load(std::memory_order_acquire);
+}
+
+// Counts an allocation and returns the allocator to serve it, waiting out a concurrent install.
+IAllocator* begin_allocation(slot_counters& c, size_t size, AllocatorSlot slot)
+{
+    for (;;) {
+        c.allocations.fetch_add(1, std::memory_order_seq_cst);
+        if (!g_installing.load(std::memory_order_seq_cst)) {
+            break;
+        }
+        c.allocations.fetch_sub(1, std::memory_order_relaxed);
+        while (g_installing.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    c.bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+    return resolve_allocator(slot);
+}
+
+void end_deallocation(slot_counters& c, size_t size)
+{
+    c.bytes_freed.fetch_add(size, std::memory_order_relaxed);
+    c.deallocations.fetch_add(1, std::memory_order_release);
+}
+
+} // anonymous namespace
+
+VELK_EXPORT void* detail::allocate(size_t size, size_t alignment, AllocatorSlot slot)
+{
+    if (auto* a = begin_allocation(local_counters(slot), size, slot)) {
+        return a->allocate(size, alignment);
+    }
+    return alignment <= default_alignment ? std::malloc(size) : aligned_alloc_impl(alignment, size);
+}
+
+VELK_EXPORT void detail::deallocate(void* ptr, size_t size, size_t alignment, AllocatorSlot slot)
+{
+    if (!ptr) {
+        return;
+    }
+    if (auto* a = resolve_allocator(slot)) {
+        a->deallocate(ptr, size, alignment);
+    } else if (alignment <= default_alignment) {
+        std::free(ptr);
+    } else {
+        aligned_free_impl(ptr);
+    }
+    end_deallocation(local_counters(slot), size);
+}
+
+VELK_EXPORT void* detail::reallocate(void* ptr, size_t old_size, size_t new_size, size_t alignment,
+                                     AllocatorSlot slot)
+{
+    if (!ptr) {
+        return allocate(new_size, alignment, slot);
+    }
+    // Counted as an allocation of the new block and a free of the old one
+    auto& c = local_counters(slot);
+    void* p;
+    if (auto* a = begin_allocation(c, new_size, slot)) {
+        p = a->reallocate(ptr, old_size, new_size, alignment);
+    } else if (alignment <= default_alignment) {
+        p = std::realloc(ptr, new_size);
+    } else {
+        p = aligned_alloc_impl(alignment, new_size);
+        if (p) {
+            std::memcpy(p, ptr, old_size < new_size ? old_size : new_size);
+            aligned_free_impl(ptr);
+        }
+    }
+    if (p) {
+        end_deallocation(c, old_size);
+    } else {
+        // The old block is still live, only the new one is not
+        c.bytes_allocated.fetch_sub(new_size, std::memory_order_relaxed);
+        c.allocations.fetch_sub(1, std::memory_order_release);
+    }
+    return p;
+}
+
+VELK_EXPORT bool detail::install_allocator(AllocatorSlot slot, IAllocator* allocator)
+{
+    static std::mutex install_mutex;
+    std::lock_guard<std::mutex> lock(install_mutex);
+
+    // Stops new allocations from picking an allocator until the install is decided
+    g_installing.store(true, std::memory_order_seq_cst);
+    bool ok = !has_outstanding(slot);
+    if (ok && slot == AllocatorSlot::Default) {
+        // Slots without their own allocator route through the Default allocator too
+        for (size_t i = 1; i < allocator_slot_count && ok; ++i) {
+            auto other = static_cast<AllocatorSlot>(i);
+            ok = g_allocators[i].load(std::memory_order_acquire) || !has_outstanding(other);
+        }
+    }
+    if (ok) {
+        g_allocators[static_cast<size_t>(slot)].store(allocator, std::memory_order_release);
+    }
+    g_installing.store(false, std::memory_order_release);
+    return ok;
+}
+
+VELK_EXPORT IAllocator* detail::get_allocator(AllocatorSlot slot)
+{
+    return g_allocators[static_cast<size_t>(slot)].load(std::memory_order_acquire);
+}
+
+VELK_EXPORT AllocatorStats detail::get_allocator_stats(AllocatorSlot slot)
+{
+    return sum_counters(slot);
+}
+
+VELK_EXPORT uint32_t detail::current_thread_tag()
+{
+    // Lazily assigned per-thread id. Never 0, so 0 can mean "no owner recorded".
+    static std::atomic<uint32_t> next{1};
+    thread_local uint32_t tag = next.fetch_add(1, std::memory_order_relaxed);
+    return tag;
+}
+
+namespace {
+
+// Owning threads of thread-confined control blocks, recorded by debug builds. The table
+// is debugging bookkeeping, so it takes its memory from malloc rather than from the
+// allocator slots, and it is never destroyed so that blocks released during static
+// destruction can still be looked up.
+template <class T>
+struct MallocAllocator
+{
+    using value_type = T;
+    MallocAllocator() = default;
+    template <class U>
+    MallocAllocator(const MallocAllocator<U>&) noexcept
+    {}
+    T* allocate(size_t n)
+    {
+        void* p = std::malloc(n * sizeof(T));
+        if (!p) {
+            std::abort();
+        }
+        return static_cast<T*>(p);
+    }
+    void deallocate(T* p, size_t) noexcept { std::free(p); }
+    template <class U>
+    bool operator==(const MallocAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+    template <class U>
+    bool operator!=(const MallocAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+struct LocalOwners
+{
+    std::mutex mutex;
+    std::unordered_map<const control_block*, uint32_t, std::hash<const control_block*>,
+                       std::equal_to<const control_block*>,
+                       MallocAllocator<std::pair<const control_block* const, uint32_t>>>
+        owners;
+    std::atomic<size_t> count{0}; ///< Entries in owners, read without the lock.
+};
+
+LocalOwners& local_owners()
+{
+    alignas(LocalOwners) static unsigned char storage[sizeof(LocalOwners)];
+    static LocalOwners* owners = new (storage) LocalOwners;
+    return *owners;
+}
+
+} // namespace
+
+VELK_EXPORT void detail::set_local_owner(const control_block* block, uint32_t tag)
+{
+    auto& t = local_owners();
+    if (!tag && !t.count.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(t.mutex);
+    if (tag) {
+        t.owners[block] = tag;
+    } else {
+        t.owners.erase(block);
+    }
+    t.count.store(t.owners.size(), std::memory_order_release);
+}
+
+VELK_EXPORT bool detail::is_local_owner(const control_block* block)
+{
+    auto& t = local_owners();
+    if (!t.count.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(t.mutex);
+    auto it = t.owners.find(block);
+    return it == t.owners.end() || it->second == current_thread_tag();
+}
+
+namespace {
+
+// Control blocks are allocated through the Default allocator slot.
+control_block* new_block(bool external)
+{
+    if (external) {
+        return new (detail::allocate(sizeof(external_control_block), alignof(external_control_block)))
+            external_control_block;
+    }
+    return new (detail::allocate(sizeof(control_block), alignof(control_block))) control_block;
+}
+
+void delete_block(control_block* block, bool external)
+{
+    if (external) {
+        auto* ecb = static_cast<external_control_block*>(block);
+        ecb->~external_control_block();
+        detail::deallocate(ecb, sizeof(external_control_block), alignof(external_control_block));
+    } else {
+        block->~control_block();
+        detail::deallocate(block, sizeof(control_block), alignof(control_block));
+    }
+}
+
+} // anonymous namespace
+
 // Control-block pool
 //
 // Each thread keeps a free-list of recycled control_blocks to avoid hitting
 // the global allocator on every shared_ptr create/destroy. Pooled alloc is
-// ~2.5x faster than new/delete in benchmarks.
+// ~2.5x faster than new/delete in benchmarks. Pools exchange batches of
+// blocks through a global depot so that objects created on one thread and
+// released on another still hit the pool (see "Cross-thread balancing").
 //
 // Use platform TLS APIs (FLS on Windows, pthread_key on POSIX) instead of
 // C++ thread_local for two reasons:
@@ -53,38 +363,199 @@ VELK_EXPORT void detail::velk_log(ILog& log, LogLevel level, const char* file, i
 
 #if VELK_ENABLE_BLOCK_POOL
 
-#include "platform.h" // IWYU pragma: keep (platform-specific defines)
-
 namespace {
 
 // Limit our pool max size to 256 control blocks (4kB at 16B/block)
 constexpr int32_t block_pool_max_size = 256;
 
+// Number of blocks moved between a thread pool and the global depot at once.
+constexpr int32_t magazine_size = 64;
+
+// Maximum number of magazines held by each depot (64 x 64 blocks = 64kB at 16B/block).
+constexpr uint32_t depot_max_magazines = 64;
+
+// Cross-thread balancing (magazine depot)
+//
+// The thread pools alone only help when blocks are released on the thread that
+// allocated them. In producer/consumer pipelines the producer's pool always
+// misses while the consumer's pool overflows. To balance this, a thread whose
+// pool is full hands a magazine (a chain of magazine_size blocks) to a global
+// depot, and a thread whose pool is empty takes a full magazine back. Blocks
+// only cross threads in batches, so the depot is touched once per
+// magazine_size allocations at most.
+//
+// The depot is a fixed array of magazine slots threaded onto two lock-free
+// stacks (full and empty). Stack heads pack a slot index with an ABA tag into a
+// single 64-bit word, so no double-width CAS is needed. Slots are never freed,
+// which makes reading a stale slot's next link harmless.
+
+struct magazine
+{
+    control_block* head{nullptr};
+    int32_t size{0};
+    std::atomic<uint32_t> next{0}; // index + 1 of the next slot in its stack, 0 = end
+};
+
+class magazine_stack
+{
+public:
+    void push(magazine* slots, uint32_t index)
+    {
+        uint64_t old = head_.load(std::memory_order_relaxed);
+        uint64_t desired;
+        do {
+            slots[index].next.store(static_cast<uint32_t>(old), std::memory_order_relaxed);
+            desired = next_tag(old) | (index + 1);
+        } while (!head_.compare_exchange_weak(old, desired, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    bool pop(magazine* slots, uint32_t& index)
+    {
+        uint64_t old = head_.load(std::memory_order_acquire);
+        while (auto top = static_cast<uint32_t>(old)) {
+            auto next = slots[top - 1].next.load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(
+                    old, next_tag(old) | next, std::memory_order_acquire, std::memory_order_acquire)) {
+                index = top - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static uint64_t next_tag(uint64_t head) { return ((head >> 32) + 1) << 32; }
+
+    std::atomic<uint64_t> head_{0}; // low 32 bits: index + 1 of the top slot, high 32 bits: ABA tag
+};
+
+struct block_depot
+{
+    magazine slots[depot_max_magazines];
+    magazine_stack full;
+    magazine_stack empty;
+    std::atomic<uint32_t> unused{0}; // Slots [unused, depot_max_magazines) have never been handed out
+
+    // Stores a chain of blocks. Returns false if every slot is occupied.
+    bool put(control_block* head, int32_t size)
+    {
+        uint32_t index;
+        if (!empty.pop(slots, index)) {
+            index = unused.load(std::memory_order_relaxed);
+            do {
+                if (index >= depot_max_magazines) {
+                    return false;
+                }
+            } while (!unused.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+        }
+        slots[index].head = head;
+        slots[index].size = size;
+        full.push(slots, index);
+        return true;
+    }
+
+    // Takes a full magazine. Returns false if the depot holds none.
+    bool take(control_block*& head, int32_t& size)
+    {
+        uint32_t index;
+        if (!full.pop(slots, index)) {
+            return false;
+        }
+        head = slots[index].head;
+        size = slots[index].size;
+        slots[index].head = nullptr;
+        slots[index].size = 0;
+        empty.push(slots, index);
+        return true;
+    }
+};
+
+block_depot g_depot;     // Magazines of control_block
+block_depot g_ext_depot; // Magazines of external_control_block
+
 struct block_pool
 {
     control_block* head{nullptr};
     int32_t size{0};
     external_control_block* ext_head{nullptr};
     int32_t ext_size{0};
+    detail::block_pool_stats stats{};
 };
 
-void drain_pool(block_pool* pool)
+// Pools come from the Default slot like the blocks they cache.
+block_pool* new_pool()
 {
-    while (pool->head) {
-        auto* next = static_cast<control_block*>(pool->head->get_ptr());
-        delete pool->head;
-        pool->head = next;
+    auto* p = detail::allocate(sizeof(block_pool), alignof(block_pool));
+    return p ? new (p) block_pool : nullptr;
+}
+
+void delete_pool(block_pool* pool)
+{
+    pool->~block_pool();
+    detail::deallocate(pool, sizeof(block_pool), alignof(block_pool));
+}
+
+void delete_chain(control_block* head, bool external)
+{
+    while (head) {
+        auto* next = static_cast<control_block*>(head->get_ptr());
+        delete_block(head, external);
+        head = next;
     }
-    pool->size = 0;
-    while (pool->ext_head) {
-        auto* next =
-            static_cast<external_control_block*>(static_cast<control_block*>(pool->ext_head->get_ptr()));
-        delete pool->ext_head;
-        pool->ext_head = next;
+}
+
+// Moves whole magazines from a thread's free-list to the depot, leaving
+// at most `keep` blocks in the list. Returns the number of magazines moved.
+uint64_t flush_to_depot(block_depot& depot, control_block*& head, int32_t& size, int32_t keep)
+{
+    uint64_t flushed = 0;
+    while (size - keep >= magazine_size) {
+        auto* first = head;
+        auto* last = head;
+        for (int32_t i = 1; i < magazine_size; ++i) {
+            last = static_cast<control_block*>(last->get_ptr());
+        }
+        auto* rest = static_cast<control_block*>(last->get_ptr());
+        last->set_ptr(nullptr);
+        if (!depot.put(first, magazine_size)) {
+            last->set_ptr(rest);
+            break;
+        }
+        head = rest;
+        size -= magazine_size;
+        ++flushed;
     }
+    return flushed;
+}
+
+// Called on thread exit: hands full magazines to the depot so other threads can
+// reuse them, and frees the remainder.
+void drain_pool(block_pool* pool)
+{
+    flush_to_depot(g_depot, pool->head, pool->size, 0);
+    delete_chain(pool->head, false);
+    pool->head = nullptr;
+    pool->size = 0;
+    control_block* ext_head = pool->ext_head;
+    flush_to_depot(g_ext_depot, ext_head, pool->ext_size, 0);
+    delete_chain(ext_head, true);
+    pool->ext_head = nullptr;
     pool->ext_size = 0;
 }
 
+// Frees every block held by the depots. Called once the thread pools are gone.
+void drain_depots()
+{
+    control_block* head;
+    int32_t size;
+    while (g_depot.take(head, size)) {
+        delete_chain(head, false);
+    }
+    while (g_ext_depot.take(head, size)) {
+        delete_chain(head, true);
+    }
+}
+
 #ifdef _WIN32
 
 // Windows: FLS (Fiber-Local Storage) with cleanup callback.
@@ -104,7 +575,7 @@ void WINAPI fls_callback(void* data)
     t_cache = nullptr;
     if (auto* pool = static_cast<block_pool*>(data)) {
         drain_pool(pool);
-        delete pool;
+        delete_pool(pool);
     }
 }
 
@@ -123,6 +594,8 @@ struct fls_init
             // Invalidate so any thread with a stale t_cache falls through
             // to the g_fls_index check and returns nullptr
             g_fls_index = FLS_OUT_OF_INDEXES;
+            // Every pool has been drained into the depots by now
+            drain_depots();
         }
     }
 };
@@ -152,10 +625,13 @@ block_pool* get_pool_ptr()
     auto* pool = static_cast<block_pool*>(FlsGetValue(g_fls_index));
     if (!pool) {
         // Not in FLS, create a new pool
-        pool = new block_pool;
+        pool = new_pool();
+        if (!pool) {
+            return nullptr;
+        }
         // Store the pointer to FLS
         if (!FlsSetValue(g_fls_index, pool)) {
-            delete pool;
+            delete_pool(pool);
             return nullptr;
         }
     }
@@ -185,7 +661,7 @@ void pthread_key_callback(void* data)
     }
     auto* pool = static_cast<block_pool*>(data);
     drain_pool(pool);
-    delete pool;
+    delete_pool(pool);
 }
 
 // Global key shared by all threads. Same role as g_fls_index on Windows.
@@ -209,6 +685,8 @@ struct key_init
         if (g_key_valid) {
             pthread_key_delete(g_pool_key);
             g_key_valid = false;
+            // Pools of threads that already exited were drained into the depots
+            drain_depots();
         }
     }
 };
@@ -230,9 +708,12 @@ block_pool* get_pool_ptr()
     }
     auto* pool = static_cast<block_pool*>(pthread_getspecific(g_pool_key));
     if (!pool) {
-        pool = new block_pool;
+        pool = new_pool();
+        if (!pool) {
+            return nullptr;
+        }
         if (pthread_setspecific(g_pool_key, pool) != 0) {
-            delete pool;
+            delete_pool(pool);
             return nullptr;
         }
     }
@@ -250,39 +731,56 @@ block_pool* get_pool_ptr()
 
 VELK_EXPORT control_block* detail::alloc_control_block(bool external)
 {
+    auto* pool = get_pool_ptr();
+    if (pool) {
+        ++pool->stats.allocs;
+    }
     if (external) {
-        auto* pool = get_pool_ptr();
+        if (pool && !pool->ext_head) {
+            control_block* head;
+            if (g_ext_depot.take(head, pool->ext_size)) {
+                pool->ext_head = static_cast<external_control_block*>(head);
+                ++pool->stats.refills;
+            }
+        }
         if (pool && pool->ext_head) {
             auto* b = pool->ext_head;
             pool->ext_head = static_cast<external_control_block*>(static_cast<control_block*>(b->get_ptr()));
             --pool->ext_size;
+            ++pool->stats.hits;
             b->strong.store(1, std::memory_order_relaxed);
             b->weak.store(1, std::memory_order_relaxed);
             b->set_ptr(nullptr);
             b->destroy = nullptr;
             return b;
         }
-        auto* b = new external_control_block;
+        auto* b = static_cast<external_control_block*>(new_block(true));
         b->strong.store(1, std::memory_order_relaxed);
         return b;
     }
-    auto* pool = get_pool_ptr();
+    if (pool && !pool->head) {
+        if (g_depot.take(pool->head, pool->size)) {
+            ++pool->stats.refills;
+        }
+    }
     if (pool && pool->head) {
         auto* b = pool->head;
         pool->head = static_cast<control_block*>(b->get_ptr());
         --pool->size;
+        ++pool->stats.hits;
         b->strong.store(1, std::memory_order_relaxed);
         b->weak.store(1, std::memory_order_relaxed);
         b->set_ptr(nullptr);
         return b;
     }
-    auto* b = new control_block;
+    auto* b = new_block(false);
     b->strong.store(1, std::memory_order_relaxed);
     return b;
 }
 
 VELK_EXPORT void detail::dealloc_control_block(control_block* block, bool external)
 {
+    detail::set_local_owner(block, 0); // A recycled block starts without an owner
     // Embedded blocks live inside a larger allocation and must not be deleted or pooled.
     // When external+embedded, call the destroy callback as a "weak dealloc" notification
     // so the owning container (e.g. Hive) can track outstanding weak references.
@@ -296,43 +794,64 @@ VELK_EXPORT void detail::dealloc_control_block(control_block* block, bool extern
         return;
     }
 
+    auto* pool = get_pool_ptr();
+    if (!pool) {
+        delete_block(block, external);
+        return;
+    }
     if (external) {
-        auto* pool = get_pool_ptr();
-        if (!pool || pool->ext_size >= block_pool_max_size) {
-            delete static_cast<external_control_block*>(block);
-            return;
+        if (pool->ext_size >= block_pool_max_size) {
+            // Pool full: hand one magazine to the depot to make room
+            control_block* head = pool->ext_head;
+            pool->stats.flushes +=
+                flush_to_depot(g_ext_depot, head, pool->ext_size, block_pool_max_size - magazine_size);
+            pool->ext_head = static_cast<external_control_block*>(head);
+            if (pool->ext_size >= block_pool_max_size) {
+                delete_block(block, true);
+                return;
+            }
         }
         block->set_ptr(pool->ext_head);
         pool->ext_head = static_cast<external_control_block*>(block);
         ++pool->ext_size;
         return;
     }
-    auto* pool = get_pool_ptr();
-    if (!pool || pool->size >= block_pool_max_size) {
-        delete block;
-        return;
+    if (pool->size >= block_pool_max_size) {
+        pool->stats.flushes +=
+            flush_to_depot(g_depot, pool->head, pool->size, block_pool_max_size - magazine_size);
+        if (pool->size >= block_pool_max_size) {
+            delete_block(block, false);
+            return;
+        }
     }
     block->set_ptr(pool->head);
     pool->head = block;
     ++pool->size;
 }
 
+VELK_EXPORT detail::block_pool_stats detail::get_block_pool_stats()
+{
+    auto* pool = get_pool_ptr();
+    return pool ? pool->stats : block_pool_stats{};
+}
+
 #else // !VELK_ENABLE_BLOCK_POOL
 
 VELK_EXPORT control_block* detail::alloc_control_block(bool external)
 {
     if (external) {
-        auto* b = new external_control_block;
+        auto* b = static_cast<external_control_block*>(new_block(true));
         b->strong.store(1, std::memory_order_relaxed);
         return b;
     }
-    auto* b = new control_block;
+    auto* b = new_block(false);
     b->strong.store(1, std::memory_order_relaxed);
     return b;
 }
 
 VELK_EXPORT void detail::dealloc_control_block(control_block* block, bool external)
 {
+    detail::set_local_owner(block, 0); // A recycled block starts without an owner
     if (block->is_embedded()) {
         if (external) {
             auto* ecb = static_cast<external_control_block*>(block);
@@ -343,11 +862,12 @@ VELK_EXPORT void detail::dealloc_control_block(control_block* block, bool extern
         return;
     }
 
-    if (external) {
-        delete static_cast<external_control_block*>(block);
-    } else {
-        delete block;
-    }
+    delete_block(block, external);
+}
+
+VELK_EXPORT detail::block_pool_stats detail::get_block_pool_stats()
+{
+    return {};
 }
 
 #endif // VELK_ENABLE_BLOCK_POOL
@@ -4,6 +4,7 @@
 #include "hive/raw_hive.h"
 #include "object_storage.h"
 
+#include <velk/api/velk.h>
 #include <velk/interface/types.h>
 
 namespace velk {
@@ -12,6 +13,7 @@ static IRawHive::Ptr create_metadata_hive()
 {
     auto obj = ext::make_object<RawHiveImpl>();
     auto* hive = static_cast<RawHiveImpl*>(obj.get());
+    hive->set_allocator_slot(AllocatorSlot::Metadata);
     hive->init(type_uid<ObjectStorage>(), sizeof(ObjectStorage), alignof(ObjectStorage));
     return interface_pointer_cast<IRawHive>(obj);
 }
@@ -88,7 +90,8 @@ void VelkInstance::queue_deferred_property(DeferredPropertySet task) const
     deferred_property_queue_.push_back(std::move(task));
 }
 
-void VelkInstance::flush_deferred_properties(std::vector<DeferredPropertySet>& propSets) const
+void VelkInstance::flush_deferred_properties(
+    slot_vector<DeferredPropertySet, AllocatorSlot::Deferred>& propSets) const
 {
     // Coalesce property sets: walk backwards, lock each weak_ptr once, keep last-write-wins.
     // Entries with null value are notification-only (value already written via set_value_silent).
@@ -97,7 +100,7 @@ void VelkInstance::flush_deferred_properties(std::vector<DeferredPropertySet>& p
         IPropertyInternal::Ptr property;
         IAny* value; // null = notification-only (value already applied)
     };
-    std::vector<CoalescedEntry> unique;
+    slot_vector<CoalescedEntry, AllocatorSlot::Deferred> unique;
     unique.reserve(propSets.size()); // Assume we have mostly unique properties
     for (auto it = propSets.rbegin(); it != propSets.rend(); ++it) {
         auto locked = it->property.lock();
@@ -121,7 +124,7 @@ void VelkInstance::flush_deferred_properties(std::vector<DeferredPropertySet>& p
         }
     }
     // First pass: apply all values silently in original queue order, collect those needing notification.
-    std::vector<IPropertyInternal*> notify;
+    slot_vector<IPropertyInternal*, AllocatorSlot::Deferred> notify;
     notify.reserve(unique.size()); // Assume that values mostly change
     for (auto it = unique.rbegin(); it != unique.rend(); ++it) {
         if (it->value) {
@@ -147,8 +150,8 @@ void VelkInstance::update(Duration time) const
 
     // Swap the queues under lock, then invoke outside the lock.
     // Tasks queued during invocation (by deferred handlers) will be picked up at the next update().
-    std::vector<DeferredTask> tasks;
-    std::vector<DeferredPropertySet> propSets;
+    slot_vector<DeferredTask, AllocatorSlot::Deferred> tasks;
+    slot_vector<DeferredPropertySet, AllocatorSlot::Deferred> propSets;
     {
         std::lock_guard lock(deferred_mutex_);
         tasks.swap(deferred_queue_);
@@ -199,6 +202,20 @@ IFunction::Ptr VelkInstance::create_owned_callback(void* context, IFunction::Bou
     return func;
 }
 
+ReturnValue VelkInstance::set_allocator(AllocatorSlot slot, IAllocator* allocator)
+{
+    if (!detail::install_allocator(slot, allocator)) {
+        VELK_LOG(E, "Cannot change allocator of slot %u: allocations are outstanding", unsigned(slot));
+        return ReturnValue::Fail;
+    }
+    return ReturnValue::Success;
+}
+
+AllocatorStats VelkInstance::get_allocator_stats(AllocatorSlot slot) const
+{
+    return detail::get_allocator_stats(slot);
+}
+
 void VelkInstance::set_sink(const ILogSink::Ptr& sink)
 {
     sink_ = sink;
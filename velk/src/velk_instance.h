@@ -2,6 +2,7 @@
 #define VELK_INSTANCE_H
 
 #include "plugin_registry.h"
+#include "slot_allocator.h"
 #include "type_registry.h"
 
 #include <velk/api/hive/raw_hive.h>
@@ -50,6 +51,8 @@ public:
     IFunction::Ptr create_callback(IFunction::CallableFn* fn) const override;
     IFunction::Ptr create_owned_callback(void* context, IFunction::BoundFn* fn,
                                          IFunction::ContextDeleter* deleter) const override;
+    ReturnValue set_allocator(AllocatorSlot slot, IAllocator* allocator) override;
+    AllocatorStats get_allocator_stats(AllocatorSlot slot) const override;
 
     void set_sink(const ILogSink::Ptr& sink) override;
     void set_level(LogLevel level) override;
@@ -58,7 +61,7 @@ public:
 
 private:
     /** @brief Coalesces and applies queued deferred property sets (last-write-wins). */
-    void flush_deferred_properties(std::vector<DeferredPropertySet>& propSets) const;
+    void flush_deferred_properties(slot_vector<DeferredPropertySet, AllocatorSlot::Deferred>& propSets) const;
 
     mutable RawHive<ObjectStorage>
         metadata_hive_;                 ///< Pool allocator for ObjectStorage instances (destroyed last).
@@ -67,8 +70,9 @@ private:
     TypeRegistry type_registry_;        ///< Registry of class factories.
     PluginRegistry plugin_registry_;    ///< Registry of loaded plugins.
     mutable std::mutex deferred_mutex_; ///< Guards @c deferred_queue_.
-    mutable std::vector<DeferredTask> deferred_queue_; ///< Tasks queued for the next update() call.
-    mutable std::vector<DeferredPropertySet>
+    mutable slot_vector<DeferredTask, AllocatorSlot::Deferred>
+        deferred_queue_; ///< Tasks queued for the next update() call.
+    mutable slot_vector<DeferredPropertySet, AllocatorSlot::Deferred>
         deferred_property_queue_; ///< Property sets queued for the next update() call.
 };
 